@@ -185,6 +185,22 @@ public:
     /// (after the body has completed).
     TaskLocal::Item *head = nullptr;
 
+    /// A single-entry cache of the most recent successful lookup.
+    ///
+    /// Consumers such as tracing read the same task-local on every event, and
+    /// each lookup walks the item chain, which spans the task's parents for
+    /// deep task trees. Remembering the item that satisfied the last lookup
+    /// turns those repeated reads into a single comparison.
+    ///
+    /// The cached item is always the one an uncached walk would find first for
+    /// its key: lookups cache the item they found, and pushing a binding
+    /// replaces the cache with the new item, so a cached entry can never be
+    /// shadowed. The cache may point at an item owned by a parent task; that
+    /// is safe for the same reason the chain traversal is, as parent bindings
+    /// are guaranteed to outlive this task. Like `head`, this is only accessed
+    /// from the task that owns the storage.
+    TaskLocal::Item *recentLookup = nullptr;
+
   public:
 
     void initializeLinkParent(AsyncTask *task, AsyncTask *parent);
@@ -22,6 +22,7 @@
 #include "clang/Lex/Preprocessor.h"
 #include "clang/Sema/Lookup.h"
 #include "clang/Sema/Sema.h"
+#include "llvm/ADT/DenseMap.h"
 #include "llvm/ADT/TinyPtrVector.h"
 #include "llvm/ADT/STLExtras.h"
 #include "llvm/Support/CommandLine.h"
@@ -181,6 +182,14 @@ class SDKContext {
   // The common version of two ABI/API descriptors under comparison.
   std::optional<uint8_t> CommonVersion;
 
+  // Memoized results of isEqual(). The matchers compare whole subtrees at
+  // every level of the descent, so without caching the equality of a node
+  // pair is recomputed once per ancestor. Node contents are immutable during
+  // matching (annotations are tracked separately), so a result never goes
+  // stale.
+  llvm::DenseMap<std::pair<const SDKNode *, const SDKNode *>, bool>
+      EqualCache;
+
 public:
   // Define the set of known identifiers.
 #define IDENTIFIER_WITH_NAME(Name, IdStr) StringRef Id_##Name = IdStr;
@@ -90,15 +90,19 @@ public:
 };
 
 SWIFT_NAME("BridgedDeclBaseName.createConstructor()")
+BRIDGED_INLINE
 BridgedDeclBaseName BridgedDeclBaseName_createConstructor();
 
 SWIFT_NAME("BridgedDeclBaseName.createDestructor()")
+BRIDGED_INLINE
 BridgedDeclBaseName BridgedDeclBaseName_createDestructor();
 
 SWIFT_NAME("BridgedDeclBaseName.createSubscript()")
+BRIDGED_INLINE
 BridgedDeclBaseName BridgedDeclBaseName_createSubscript();
 
 SWIFT_NAME("BridgedDeclBaseName.createIdentifier(_:)")
+BRIDGED_INLINE
 BridgedDeclBaseName
 BridgedDeclBaseName_createIdentifier(BridgedIdentifier identifier);
 
@@ -122,6 +126,7 @@ BridgedDeclNameRef_createParsed(BridgedASTContext cContext,
                                 BridgedArrayRef cLabels);
 
 SWIFT_NAME("BridgedDeclNameRef.createParsed(_:)")
+BRIDGED_INLINE
 BridgedDeclNameRef
 BridgedDeclNameRef_createParsed(BridgedDeclBaseName cBaseName);
 
@@ -151,6 +156,7 @@ BridgedDeclNameLoc BridgedDeclNameLoc_createParsed(
     BridgedSourceLoc cRParenLoc);
 
 SWIFT_NAME("BridgedDeclNameLoc.createParsed(_:)")
+BRIDGED_INLINE
 BridgedDeclNameLoc
 BridgedDeclNameLoc_createParsed(BridgedSourceLoc cBaseNameLoc);
 
@@ -413,6 +419,7 @@ void BridgedDiagnostic_finish(BridgedDiagnostic cDiag);
 //===----------------------------------------------------------------------===//
 
 SWIFT_NAME("getter:BridgedDeclContext.isLocalContext(self:)")
+BRIDGED_INLINE
 bool BridgedDeclContext_isLocalContext(BridgedDeclContext cDeclContext);
 
 SWIFT_NAME("BridgedPatternBindingInitializer.create(declContext:)")
@@ -1307,6 +1314,7 @@ BridgedUnresolvedPatternExpr_createParsed(BridgedASTContext cContext,
                                           BridgedPattern cPattern);
 
 SWIFT_NAME("BridgedExpr.setImplicit(self:)")
+BRIDGED_INLINE
 void BridgedExpr_setImplicit(BridgedExpr cExpr);
 
 SWIFT_NAME("BridgedExpr.dump(self:)")
@@ -1344,6 +1352,7 @@ public:
 };
 
 SWIFT_NAME("BridgedStmtConditionElement.createBoolean(expr:)")
+BRIDGED_INLINE
 BridgedStmtConditionElement
 BridgedStmtConditionElement_createBoolean(BridgedExpr expr);
 
@@ -1758,9 +1767,11 @@ BridgedTypedPattern BridgedTypedPattern_createPropagated(
     BridgedASTContext cContext, BridgedPattern cPattern, BridgedTypeRepr cType);
 
 SWIFT_NAME("BridgedPattern.setImplicit(self:)")
+BRIDGED_INLINE
 void BridgedPattern_setImplicit(BridgedPattern cPattern);
 
 SWIFT_NAME("getter:BridgedPattern.boundName(self:)")
+BRIDGED_INLINE
 BridgedIdentifier BridgedPattern_getBoundName(BridgedPattern cPattern);
 
 //===----------------------------------------------------------------------===//
@@ -1883,6 +1894,18 @@ bool Plugin_sendMessage(PluginHandle handle, const BridgedData data);
 /// Receive a message from the plugin.
 bool Plugin_waitForNextMessage(PluginHandle handle, BridgedData *data);
 
+/// Look up a cached response for the expansion request \c request in the
+/// on-disk macro expansion cache. Returns true and populates \c response on
+/// a cache hit.
+bool Plugin_lookupCachedExpansion(PluginHandle handle,
+                                  const BridgedData request,
+                                  BridgedData *response);
+
+/// Record \c response as the result of the expansion request \c request in
+/// the on-disk macro expansion cache.
+void Plugin_cacheExpansion(PluginHandle handle, const BridgedData request,
+                           const BridgedData response);
+
 SWIFT_END_ASSUME_NONNULL
 
 SWIFT_END_NULLABILITY_ANNOTATIONS
@@ -14,9 +14,52 @@
 #define SWIFT_AST_ASTBRIDGINGIMPL_H
 
 #include "swift/AST/Decl.h"
+#include "swift/AST/DeclNameLoc.h"
+#include "swift/AST/Expr.h"
+#include "swift/AST/Pattern.h"
+#include "swift/AST/Stmt.h"
 
 SWIFT_BEGIN_NULLABILITY_ANNOTATIONS
 
+//===----------------------------------------------------------------------===//
+// MARK: BridgedDeclBaseName
+//===----------------------------------------------------------------------===//
+
+BridgedDeclBaseName BridgedDeclBaseName_createConstructor() {
+  return swift::DeclBaseName::createConstructor();
+}
+
+BridgedDeclBaseName BridgedDeclBaseName_createDestructor() {
+  return swift::DeclBaseName::createDestructor();
+}
+
+BridgedDeclBaseName BridgedDeclBaseName_createSubscript() {
+  return swift::DeclBaseName::createSubscript();
+}
+
+BridgedDeclBaseName
+BridgedDeclBaseName_createIdentifier(BridgedIdentifier identifier) {
+  return swift::DeclBaseName(identifier.unbridged());
+}
+
+//===----------------------------------------------------------------------===//
+// MARK: BridgedDeclNameRef
+//===----------------------------------------------------------------------===//
+
+BridgedDeclNameRef
+BridgedDeclNameRef_createParsed(BridgedDeclBaseName cBaseName) {
+  return swift::DeclNameRef(cBaseName.unbridged());
+}
+
+//===----------------------------------------------------------------------===//
+// MARK: BridgedDeclNameLoc
+//===----------------------------------------------------------------------===//
+
+BridgedDeclNameLoc
+BridgedDeclNameLoc_createParsed(BridgedSourceLoc cBaseNameLoc) {
+  return swift::DeclNameLoc(cBaseNameLoc.unbridged());
+}
+
 //===----------------------------------------------------------------------===//
 // MARK: BridgedASTContext
 //===----------------------------------------------------------------------===//
@@ -29,6 +72,14 @@ BridgedASTContext BridgedASTContext_fromRaw(void * _Nonnull ptr) {
   return *static_cast<swift::ASTContext *>(ptr);
 }
 
+//===----------------------------------------------------------------------===//
+// MARK: BridgedDeclContext
+//===----------------------------------------------------------------------===//
+
+bool BridgedDeclContext_isLocalContext(BridgedDeclContext cDeclContext) {
+  return cDeclContext.unbridged()->isLocalContext();
+}
+
 //===----------------------------------------------------------------------===//
 // MARK: BridgedNominalTypeDecl
 //===----------------------------------------------------------------------===//
@@ -72,6 +123,35 @@ BridgedVarDecl_asAbstractStorageDecl(BridgedVarDecl decl) {
   return decl.unbridged();
 }
 
+//===----------------------------------------------------------------------===//
+// MARK: BridgedExpr
+//===----------------------------------------------------------------------===//
+
+void BridgedExpr_setImplicit(BridgedExpr cExpr) {
+  cExpr.unbridged()->setImplicit();
+}
+
+//===----------------------------------------------------------------------===//
+// MARK: BridgedStmtConditionElement
+//===----------------------------------------------------------------------===//
+
+BridgedStmtConditionElement
+BridgedStmtConditionElement_createBoolean(BridgedExpr expr) {
+  return swift::StmtConditionElement(expr.unbridged());
+}
+
+//===----------------------------------------------------------------------===//
+// MARK: BridgedPattern
+//===----------------------------------------------------------------------===//
+
+void BridgedPattern_setImplicit(BridgedPattern cPattern) {
+  cPattern.unbridged()->setImplicit();
+}
+
+BridgedIdentifier BridgedPattern_getBoundName(BridgedPattern cPattern) {
+  return cPattern.unbridged()->getBoundName();
+}
+
 SWIFT_END_NULLABILITY_ANNOTATIONS
 
 #endif // SWIFT_AST_ASTBRIDGINGIMPL_H
@@ -37,6 +37,7 @@
 #include "clang/Basic/DarwinSDKInfo.h"
 #include "llvm/ADT/ArrayRef.h"
 #include "llvm/ADT/DenseMap.h"
+#include "llvm/ADT/DenseSet.h"
 #include "llvm/ADT/IntrusiveRefCntPtr.h"
 #include "llvm/ADT/MapVector.h"
 #include "llvm/ADT/PointerIntPair.h"
@@ -269,6 +270,11 @@ public:
   /// it before being set to null.
   UnifiedStatsReporter *Stats = nullptr;
 
+  /// Digests of constraint systems already solved in this frontend
+  /// invocation, used to measure how often structurally identical systems
+  /// recur. Only populated when \c Stats is non-null.
+  llvm::DenseSet<uint64_t> SolvedConstraintSystemDigests;
+
   /// The language options used for translation.
   const LangOptions &LangOpts;
 
@@ -362,6 +368,13 @@ public:
   /// The # of times we have performed typo correction.
   unsigned NumTypoCorrections = 0;
 
+  /// Cache of whole-type substitution results, keyed by the original type,
+  /// the substitution map storage, and the raw substitution flags.
+  ///
+  /// Only populated for permanent-arena types and maps; see Type::subst.
+  llvm::DenseMap<std::tuple<TypeBase *, const void *, unsigned>, Type>
+      TypeSubstitutionResults;
+
   /// Cached mapping from types to their associated tangent spaces.
   llvm::DenseMap<Type, std::optional<TangentSpace>> AutoDiffTangentSpaces;
 
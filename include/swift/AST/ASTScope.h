@@ -24,6 +24,14 @@
 ///   the nesting is illegal. For instance, a protocol nested inside of a class
 ///   does not get to see the symbols in the class or its ancestors.
 ///
+/// The tree is expanded lazily: a scope's children are created the first time
+/// a lookup (or other traversal) descends into it, so a query only pays for
+/// the spine of scopes covering its location, not the whole file. Scopes are
+/// thin views over AST nodes and have the same lifetime; when a file is
+/// re-parsed the nodes they point at are gone, so scope subtrees cannot be
+/// reused across edits — cheap re-creation plus laziness is the incremental
+/// strategy here.
+///
 //===----------------------------------------------------------------------===//
 #ifndef SWIFT_AST_AST_SCOPE_H
 #define SWIFT_AST_AST_SCOPE_H
@@ -163,7 +163,12 @@ class Evaluator {
 
   /// A vector containing all of the active evaluation requests, which
   /// is treated as a stack and is used to detect cycles.
-  llvm::SetVector<ActiveRequest> activeRequests;
+  ///
+  /// Cycle detection must happen on every push: a cycle is diagnosed for the
+  /// request that re-enters, so deferring the membership test would change
+  /// which decl the cycle diagnostic attaches to. The inline capacity keeps
+  /// the common shallow stacks free of heap allocation.
+  llvm::SmallSetVector<ActiveRequest, 32> activeRequests;
 
   /// A cache that stores the results of requests.
   evaluator::RequestCache cache;
@@ -260,7 +265,7 @@ public:
   template<typename Request,
            typename std::enable_if<!Request::hasExternalCache>::type* = nullptr>
   bool hasCachedResult(const Request &request) {
-    return cache.find_as(request) != cache.end<Request>();
+    return cache.lookup<Request>(request) != nullptr;
   }
 
   /// Do not introduce new callers of this function.
@@ -365,9 +370,10 @@ private:
   typename Request::OutputType
   getResultCached(const Request &request, Fn defaultValueFn) {
     // If we already have an entry for this request in the cache, return it.
-    auto known = cache.find_as<Request>(request);
-    if (known != cache.end<Request>()) {
-      auto result = known->second;
+    // Copy the result out immediately; evaluating dependency sinks below may
+    // mutate the cache and invalidate the pointer.
+    if (auto *known = cache.lookup<Request>(request)) {
+      auto result = *known;
       recorder.replayCachedRequest(request);
       handleDependencySinkRequest<Request>(request, result);
       return result;
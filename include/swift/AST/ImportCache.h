@@ -169,9 +169,12 @@ public:
 
   /// This is a hack to cope with main file parsing and REPL parsing, where
   /// we can add ImportDecls after import resolution.
-  void clear() {
-    ImportSetForDC.clear();
-  }
+  ///
+  /// Only entries for contexts inside 'mod' are dropped; the uniqued
+  /// ImportSets themselves and memoized entries for other modules remain
+  /// valid, since adding an ImportDecl to 'mod' cannot change what any
+  /// other module imports.
+  void clear(const ModuleDecl *mod);
 };
 
 ArrayRef<ImportedModule> getAllImports(const DeclContext *dc);
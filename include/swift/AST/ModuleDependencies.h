@@ -33,6 +33,7 @@
 #include "llvm/CAS/CASReference.h"
 #include "llvm/CAS/CachingOnDiskFileSystem.h"
 #include "llvm/CAS/ObjectStore.h"
+#include "llvm/Support/Chrono.h"
 #include "llvm/Support/Error.h"
 #include "llvm/Support/Mutex.h"
 #include "llvm/Support/PrefixMapper.h"
@@ -988,6 +989,13 @@ public:
 
   /// Setup caching service.
   bool setupCachingDependencyScanningService(CompilerInstance &Instance);
+
+  /// Remove cached entries whose defining inputs (interface file, module map,
+  /// binary module, source files) were modified after \p cutoff, together
+  /// with every cached entry that transitively depends on one. Removed
+  /// entries are simply re-scanned on their next query; everything else
+  /// stays warm. Returns the number of entries removed.
+  unsigned removeDependenciesModifiedSince(llvm::sys::TimePoint<> cutoff);
 private:
   /// Enforce clients not being allowed to query this cache directly, it must be
   /// wrapped in an instance of `ModuleDependenciesCache`.
@@ -100,6 +100,10 @@ class LoadedExecutablePlugin {
 
   std::mutex mtx;
 
+  /// Return the path of the on-disk expansion cache entry for \p request,
+  /// or an empty string if caching is disabled.
+  std::string expansionCacheEntryPath(llvm::StringRef request);
+
 public:
   LoadedExecutablePlugin(llvm::StringRef ExecutablePath,
                          llvm::sys::TimePoint<> LastModificationTime,
@@ -134,6 +138,15 @@ public:
   /// Wait for a message from plugin and returns it.
   llvm::Expected<std::string> waitForNextMessage() const;
 
+  /// Look up a cached response for the given expansion request message in
+  /// the on-disk expansion cache. Returns 'std::nullopt' if caching is
+  /// disabled or there is no entry.
+  std::optional<std::string> lookupCachedExpansion(llvm::StringRef request);
+
+  /// Record \p response as the result of the expansion request \p request
+  /// in the on-disk expansion cache, if caching is enabled.
+  void cacheExpansion(llvm::StringRef request, llvm::StringRef response);
+
   bool isInitialized() const { return bool(cleanup); }
   void setCleanup(std::function<void(void)> cleanup) {
     this->cleanup = cleanup;
@@ -242,20 +242,17 @@ class RequestCache {
 #undef SWIFT_TYPEID_ZONE
 
 public:
+  /// Look up the cached result for the given request, returning null if
+  /// there is none. The pointer is invalidated by any subsequent mutation
+  /// of the cache, so callers must copy the result out before evaluating
+  /// other requests.
   template <typename Request>
-  typename llvm::DenseMap<RequestKey<Request>,
-                          typename Request::OutputType>::const_iterator
-  find_as(const Request &req) {
-    auto *cache = getCache<Request>();
-    return cache->find_as(req);
-  }
-
-  template <typename Request>
-  typename llvm::DenseMap<RequestKey<Request>,
-                          typename Request::OutputType>::const_iterator
-  end() {
+  const typename Request::OutputType *lookup(const Request &req) {
     auto *cache = getCache<Request>();
-    return cache->end();
+    auto found = cache->find_as(req);
+    if (found == cache->end())
+      return nullptr;
+    return &found->second;
   }
 
   template <typename Request>
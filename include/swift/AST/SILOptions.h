@@ -305,6 +305,16 @@ public:
   /// The format used for serializing remarks (default: YAML)
   llvm::remarks::Format OptRecordFormat = llvm::remarks::Format::YAML;
 
+  /// The name of the file to which a profile-guided linker order file
+  /// should be written, or empty if none was requested.
+  std::string SymbolOrderFile;
+
+  /// The name of a file listing the mangled names a previous link actually
+  /// referenced, one per line, or empty if none was given. When set, dead
+  /// function elimination stops treating public functions that are absent
+  /// from the list as roots. Only sound for closed, statically linked images.
+  std::string LinkerUsedSymbolsFile;
+
   /// Are there any options that indicate that functions should not be preserved
   /// for the debugger?
   bool ShouldFunctionsBePreservedToDebugger = true;
@@ -411,6 +411,11 @@ public:
   std::pair<unsigned, unsigned>
   getPresumedLineAndColumnForLoc(SourceLoc Loc, unsigned BufferID = 0) const {
     assert(Loc.isValid());
+    // Resolve the buffer ourselves, using the sorted-range binary search and
+    // last-buffer cache; otherwise llvm::SourceMgr falls back to a linear
+    // scan over all buffers on every query.
+    if (BufferID == 0)
+      BufferID = findBufferContainingLoc(Loc);
     int LineOffset = getLineOffset(Loc);
     int l, c;
     std::tie(l, c) = LLVMSourceMgr.getLineAndColumn(Loc.Value, BufferID);
@@ -426,6 +431,9 @@ public:
   std::pair<unsigned, unsigned>
   getLineAndColumnInBuffer(SourceLoc Loc, unsigned BufferID = 0) const {
     assert(Loc.isValid());
+    // See getPresumedLineAndColumnForLoc for why the buffer is resolved here.
+    if (BufferID == 0)
+      BufferID = findBufferContainingLoc(Loc);
     return LLVMSourceMgr.getLineAndColumn(Loc.Value, BufferID);
   }
 
@@ -132,6 +132,12 @@ public:
   // -trace-stats-events, but we recycle the same FrontendStatsTracers to give
   // us some free recursion-save phase timings whenever -trace-stats-dir is
   // active at all. Reduces redundant machinery.
+  //
+  // When -trace-stats-events is active we additionally write the entry/exit
+  // stream as a Chrome trace-event JSON file, which flamegraph viewers open
+  // directly. The events are tagged with this process's pid, so traces from
+  // the jobs of a multi-job build can be merged by concatenating their
+  // traceEvents arrays.
   class RecursionSafeTimers;
 
   // We also keep a few banks of optional hierarchical profilers for times and
@@ -148,6 +154,7 @@ private:
   long maxChildRSS = 0;
   SmallString<128> StatsFilename;
   SmallString<128> TraceFilename;
+  SmallString<128> ChromeTraceFilename;
   SmallString<128> ProfileDirname;
   llvm::TimeRecord StartedTime;
   std::thread::id MainThreadID;
@@ -161,6 +168,7 @@ private:
   std::optional<AlwaysOnFrontendCounters> FrontendCounters;
   std::optional<AlwaysOnFrontendCounters> LastTracedFrontendCounters;
   std::optional<std::vector<FrontendStatsEvent>> FrontendStatsEvents;
+  std::optional<std::vector<FrontendStatsEvent>> ChromeTraceEvents;
 
   // These are unique_ptr so we can use incomplete types here.
   std::unique_ptr<RecursionSafeTimers> RecursiveTimers;
@@ -66,6 +66,15 @@ isExtendedGraphemeClusterBoundary(GraphemeClusterBreakProperty GCB1,
 
 bool isSingleUnicodeScalar(StringRef S);
 
+/// Returns the length of the longest prefix of \p S that consists entirely of
+/// ASCII bytes, scanning a machine word at a time.
+///
+/// ASCII bytes are well-formed single-byte UTF-8 sequences and can never
+/// appear in the middle of a multi-byte sequence, so callers walking UTF-8
+/// can process such a prefix in bulk before falling back to sequence-at-a-time
+/// decoding.
+size_t countLeadingASCIIBytes(StringRef S);
+
 unsigned extractFirstUnicodeScalar(StringRef S);
 
 /// Returns true if \p S does not contain any ill-formed subsequences. This does
@@ -448,6 +448,8 @@ public:
   /// prefix: _T, _T0, $S, _$S.
   ///
   /// \returns The demangled string.
+  /// Implies a call of clear(): any node tree obtained earlier from this
+  /// context is deallocated.
   std::string demangleSymbolAsString(
       llvm::StringRef MangledName,
       const DemangleOptions &Options = DemangleOptions());
@@ -458,6 +460,8 @@ public:
   /// a mangling prefix.
   ///
   /// \returns The demangled string.
+  /// Implies a call of clear(): any node tree obtained earlier from this
+  /// context is deallocated.
   std::string
   demangleTypeAsString(llvm::StringRef MangledName,
                        const DemangleOptions &Options = DemangleOptions());
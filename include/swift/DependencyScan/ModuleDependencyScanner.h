@@ -64,12 +64,16 @@ private:
 
 class ModuleDependencyScanner {
 public:
+  /// \param ParallelScan Whether to resolve imports on multiple threads.
+  /// \param ParallelScanThreads The number of threads to use when
+  /// \p ParallelScan is set; zero means one thread per hardware core.
   ModuleDependencyScanner(SwiftDependencyScanningService &ScanningService,
                           const CompilerInvocation &ScanCompilerInvocation,
                           const SILOptions &SILOptions,
                           ASTContext &ScanASTContext,
                           DependencyTracker &DependencyTracker,
-                          DiagnosticEngine &diags, bool ParallelScan);
+                          DiagnosticEngine &diags, bool ParallelScan,
+                          unsigned ParallelScanThreads = 0);
 
   /// Identify the scanner invocation's main module's dependencies
   llvm::ErrorOr<ModuleDependencyInfo>
@@ -360,6 +360,10 @@ public:
   /// to filesystem modules in parallel.
   bool ParallelDependencyScan = false;
 
+  /// The number of threads to use when \c ParallelDependencyScan is enabled.
+  /// Zero means one thread per hardware core.
+  unsigned ParallelDependencyScanThreads = 0;
+
   /// When performing an incremental build, ensure that cross-module incremental
   /// build metadata is available in any swift modules emitted by this frontend
   /// job.
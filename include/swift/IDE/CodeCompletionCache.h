@@ -20,6 +20,7 @@
 #include "llvm/ADT/Hashing.h"
 #include "llvm/ADT/IntrusiveRefCntPtr.h"
 #include "llvm/Support/Chrono.h"
+#include "llvm/Support/MemoryBuffer.h"
 #include <system_error>
 
 namespace swift {
@@ -77,6 +78,12 @@ public:
     /// \c ContextFreeCodeCompletionResult in this cache value.
     USRBasedTypeArena USRTypeArena;
 
+    /// When the results were deserialized from an on-disk cache file, the
+    /// (typically memory-mapped) file contents. Strings in \c Results
+    /// reference this buffer directly instead of being copied into
+    /// \c Allocator, so it must stay alive as long as the results do.
+    std::unique_ptr<llvm::MemoryBuffer> SerializedBuffer;
+
     Value() : Allocator(std::make_shared<llvm::BumpPtrAllocator>()) {}
   };
   using ValueRefCntPtr = llvm::IntrusiveRefCntPtr<Value>;
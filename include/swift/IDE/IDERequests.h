@@ -280,6 +280,35 @@ public:
   SourceLoc getNearestLoc() const { return SourceLoc(); };
 };
 
+//----------------------------------------------------------------------------//
+// DocCommentAsXMLRequest
+//----------------------------------------------------------------------------//
+
+/// Convert a decl's doc comment to its XML form, parsing the comment markup
+/// once per decl and caching the result for the lifetime of the AST. Repeated
+/// cursor-info requests against an unchanged AST hit the cache; editing the
+/// file rebuilds the AST and naturally invalidates it. Returns \c std::nullopt
+/// if the decl has no doc comment.
+class DocCommentAsXMLRequest
+    : public SimpleRequest<DocCommentAsXMLRequest,
+                           std::optional<StringRef>(const Decl *),
+                           RequestFlags::Cached> {
+public:
+  using SimpleRequest::SimpleRequest;
+
+private:
+  friend SimpleRequest;
+
+  // Evaluation.
+  std::optional<StringRef> evaluate(Evaluator &evaluator, const Decl *D) const;
+
+public:
+  // Caching
+  bool isCached() const { return true; }
+  // Source location
+  SourceLoc getNearestLoc() const { return SourceLoc(); };
+};
+
 /// The zone number for the IDE.
 #define SWIFT_TYPEID_ZONE IDE
 #define SWIFT_TYPEID_HEADER "swift/IDE/IDERequestIDZone.def"
@@ -93,23 +93,34 @@ class IDEInspectionInstance {
   struct Options {
     unsigned MaxASTReuseCount = 100;
     unsigned DependencyCheckIntervalSecond = 5;
+    unsigned MaxCachedCompilerInstances = 4;
   } Opts;
 
+  /// A warmed \c CompilerInstance along with the state needed to decide
+  /// whether it can be reused for a subsequent request.
+  struct CachedCompilerInstance {
+    std::shared_ptr<CompilerInstance> CI;
+    llvm::hash_code ArgHash;
+    llvm::sys::TimePoint<> DependencyCheckedTimestamp;
+    llvm::StringMap<llvm::hash_code> InMemoryDependencyHash;
+    unsigned ReuseCount = 0;
+  };
+
   std::mutex mtx;
 
   std::shared_ptr<PluginRegistry> Plugins;
 
-  std::shared_ptr<CompilerInstance> CachedCI;
-  llvm::hash_code CachedArgHash;
-  llvm::sys::TimePoint<> DependencyCheckedTimestamp;
-  llvm::StringMap<llvm::hash_code> InMemoryDependencyHash;
-  unsigned CachedReuseCount = 0;
+  /// Pool of cached instances, ordered from least to most recently used.
+  /// Each entry corresponds to a distinct (compiler arguments, inspected
+  /// file) pair so that alternating requests between files don't evict each
+  /// other's warmed instance.
+  std::vector<std::unique_ptr<CachedCompilerInstance>> CachedInstances;
   std::atomic<bool> CachedCIShouldBeInvalidated;
 
   void cacheCompilerInstance(std::shared_ptr<CompilerInstance> CI,
                              llvm::hash_code ArgsHash);
 
-  bool shouldCheckDependencies() const;
+  bool shouldCheckDependencies(const CachedCompilerInstance &Cached) const;
 
   /// Calls \p Callback with cached \c CompilerInstance if it's usable for the
   /// specified completion request.
@@ -18,13 +18,10 @@
 #define SWIFT_LOCALIZATIONFORMAT_H
 
 #include "llvm/ADT/ArrayRef.h"
-#include "llvm/ADT/Hashing.h"
 #include "llvm/ADT/STLExtras.h"
 #include "llvm/ADT/StringRef.h"
-#include "llvm/Bitstream/BitstreamReader.h"
-#include "llvm/Support/EndianStream.h"
+#include "llvm/Support/Endian.h"
 #include "llvm/Support/MemoryBuffer.h"
-#include "llvm/Support/OnDiskHashTable.h"
 #include "llvm/Support/StringSaver.h"
 #include "llvm/Support/raw_ostream.h"
 #include <cstdint>
@@ -48,6 +45,22 @@ enum LocalizationProducerState : uint8_t {
   FailedInitialization
 };
 
+/// A serialized translations file is a flat direct-index table:
+///
+///   uint32: magic number
+///   uint32: format version
+///   uint32: number of entries
+///   uint32 x entries: cumulative end offset of each message in the blob,
+///                     indexed directly by diagnostic ID
+///   the concatenated message bytes
+///
+/// All fields are little-endian. Diagnostic IDs without a translation have
+/// an empty slot. The layout needs no per-process parsing or heap at all, so
+/// the file can be mapped read-only and its pages shared across every
+/// concurrent frontend job.
+constexpr uint32_t serializedLocalizationMagic = 0x4C4F4344; // 'LOCD'
+constexpr uint32_t serializedLocalizationVersion = 1;
+
 class DefToStringsConverter {
   llvm::ArrayRef<const char *> IDs;
   llvm::ArrayRef<const char *> Messages;
@@ -62,81 +75,10 @@ public:
   void convert(llvm::raw_ostream &out);
 };
 
-class LocalizationWriterInfo {
-public:
-  using key_type = uint32_t;
-  using key_type_ref = const uint32_t &;
-  using data_type = std::string;
-  using data_type_ref = llvm::StringRef;
-  using hash_value_type = uint32_t;
-  using offset_type = uint32_t;
-
-  hash_value_type ComputeHash(key_type_ref key) { return llvm::hash_code(key); }
-
-  std::pair<offset_type, offset_type> EmitKeyDataLength(llvm::raw_ostream &out,
-                                                        key_type_ref key,
-                                                        data_type_ref data) {
-    offset_type dataLength = static_cast<offset_type>(data.size());
-    endian::write<offset_type>(out, dataLength, little);
-    // No need to write the key length; it's constant.
-    return {sizeof(key_type), dataLength};
-  }
-
-  void EmitKey(llvm::raw_ostream &out, key_type_ref key, unsigned len) {
-    assert(len == sizeof(key_type));
-    endian::write<key_type>(out, key, little);
-  }
-
-  void EmitData(llvm::raw_ostream &out, key_type_ref key, data_type_ref data,
-                unsigned len) {
-    out << data;
-  }
-};
-
-class LocalizationReaderInfo {
-public:
-  using internal_key_type = uint32_t;
-  using external_key_type = swift::DiagID;
-  using data_type = llvm::StringRef;
-  using hash_value_type = uint32_t;
-  using offset_type = uint32_t;
-
-  internal_key_type GetInternalKey(external_key_type key) {
-    return static_cast<internal_key_type>(key);
-  }
-
-  external_key_type GetExternalKey(internal_key_type key) {
-    return static_cast<external_key_type>(key);
-  }
-
-  static bool EqualKey(internal_key_type lhs, internal_key_type rhs) {
-    return lhs == rhs;
-  }
-
-  hash_value_type ComputeHash(internal_key_type key) {
-    return llvm::hash_code(key);
-  }
-
-  static std::pair<offset_type, offset_type>
-  ReadKeyDataLength(const unsigned char *&data) {
-    offset_type dataLength =
-        endian::readNext<offset_type, little, unaligned>(data);
-    return {sizeof(uint32_t), dataLength};
-  }
-
-  internal_key_type ReadKey(const unsigned char *data, offset_type length) {
-    return endian::readNext<internal_key_type, little, unaligned>(data);
-  }
-
-  data_type ReadData(internal_key_type Key, const unsigned char *data,
-                     offset_type length) {
-    return data_type((const char *)data, length);
-  }
-};
-
 class SerializedLocalizationWriter {
-  using offset_type = LocalizationWriterInfo::offset_type;
-  llvm::OnDiskChainedHashTableGenerator<LocalizationWriterInfo> generator;
+  /// Translations indexed directly by diagnostic ID. Identifiers which were
+  /// never inserted keep an empty message.
+  std::vector<std::string> Translations;
 
 public:
   /// Enqueue the given diagnostic to be included in a serialized translations
@@ -228,11 +170,17 @@ private:
 };
 
 class SerializedLocalizationProducer final : public LocalizationProducer {
-  using SerializedLocalizationTable =
-      llvm::OnDiskIterableChainedHashTable<LocalizationReaderInfo>;
-  using offset_type = LocalizationReaderInfo::offset_type;
   std::unique_ptr<llvm::MemoryBuffer> Buffer;
-  std::unique_ptr<SerializedLocalizationTable> SerializedTable;
+
+  /// Number of entries in the direct-index offset table.
+  uint32_t Count = 0;
+
+  /// Cumulative end offset of each message within \c Blob, indexed directly
+  /// by diagnostic ID. Points into \c Buffer.
+  const llvm::support::ulittle32_t *Offsets = nullptr;
+
+  /// The concatenated message bytes. Points into \c Buffer.
+  const char *Blob = nullptr;
 
 public:
   explicit SerializedLocalizationProducer(
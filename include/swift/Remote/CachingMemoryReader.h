@@ -0,0 +1,164 @@
+//===--- CachingMemoryReader.h - Page-caching MemoryReader ------*- C++ -*-===//
+//
+// This source file is part of the Swift.org open source project
+//
+// Copyright (c) 2014 - 2026 Apple Inc. and the Swift project authors
+// Licensed under Apache License v2.0 with Runtime Library Exception
+//
+// See https://swift.org/LICENSE.txt for license information
+// See https://swift.org/CONTRIBUTORS.txt for the list of Swift project authors
+//
+//===----------------------------------------------------------------------===//
+//
+//  This file declares a MemoryReader which caches page-granular reads from
+//  an underlying reader. Metadata walks issue many small adjacent reads; over
+//  a debug transport each one is a round trip, so fetching whole pages and
+//  serving subsequent reads locally collapses most of those round trips.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef SWIFT_REMOTE_CACHINGMEMORYREADER_H
+#define SWIFT_REMOTE_CACHINGMEMORYREADER_H
+
+#include "swift/Remote/MemoryReader.h"
+
+#include <unordered_map>
+#include <unordered_set>
+
+namespace swift {
+namespace remote {
+
+/// A MemoryReader which wraps another reader and caches target memory at
+/// page granularity.
+///
+/// The cache assumes the remote process is not mutating the memory being
+/// inspected, which holds for the usual clients (suspended processes and
+/// core files). Callers which resume the target must call \c invalidateCache
+/// before issuing further reads.
+class CachingMemoryReader final : public MemoryReader {
+  /// Granularity of cached fetches from the underlying reader.
+  static constexpr uint64_t PageSize = 4096;
+
+  std::shared_ptr<MemoryReader> Underlying;
+
+  /// Cached pages, keyed by page base address.
+  std::unordered_map<uint64_t, std::unique_ptr<uint8_t[]>> Pages;
+
+  /// Page base addresses whose page-granular fetch failed, usually because
+  /// rounding a read up to page size crossed into unmapped memory. Reads
+  /// touching these pages go straight to the underlying reader instead of
+  /// re-attempting a doomed bulk fetch on every read.
+  std::unordered_set<uint64_t> UnreadablePages;
+
+public:
+  explicit CachingMemoryReader(std::shared_ptr<MemoryReader> underlying)
+      : Underlying(std::move(underlying)) {}
+
+  /// Drop all cached target memory. Must be called whenever the remote
+  /// process may have mutated, e.g. when it resumes execution.
+  void invalidateCache() {
+    Pages.clear();
+    UnreadablePages.clear();
+  }
+
+  bool queryDataLayout(DataLayoutQueryType type, void *inBuffer,
+                       void *outBuffer) override {
+    return Underlying->queryDataLayout(type, inBuffer, outBuffer);
+  }
+
+  RemoteAddress getSymbolAddress(const std::string &name) override {
+    return Underlying->getSymbolAddress(name);
+  }
+
+  bool readString(RemoteAddress address, std::string &dest) override {
+    return Underlying->readString(address, dest);
+  }
+
+  RemoteAbsolutePointer resolvePointer(RemoteAddress address,
+                                       uint64_t readValue) override {
+    return Underlying->resolvePointer(address, readValue);
+  }
+
+  std::optional<RemoteAbsolutePointer>
+  resolvePointerAsSymbol(RemoteAddress address) override {
+    return Underlying->resolvePointerAsSymbol(address);
+  }
+
+  RemoteAbsolutePointer getSymbol(RemoteAddress address) override {
+    return Underlying->getSymbol(address);
+  }
+
+  RemoteAbsolutePointer getDynamicSymbol(RemoteAddress address) override {
+    return Underlying->getDynamicSymbol(address);
+  }
+
+  bool readBytes(RemoteAddress address, uint8_t *dest,
+                 uint64_t size) override {
+    if (size == 0)
+      return true;
+
+    // Large reads are one round trip anyway and would only churn the cache.
+    if (size > PageSize)
+      return Underlying->readBytes(address, dest, size);
+
+    uint64_t addr = address.getAddressData();
+    uint64_t firstPage = addr & ~(PageSize - 1);
+    uint64_t lastPage = (addr + size - 1) & ~(PageSize - 1);
+
+    // If part of the range is known not to be fetchable at page granularity,
+    // don't try again; read exactly what was asked for.
+    for (uint64_t page = firstPage; page <= lastPage; page += PageSize)
+      if (UnreadablePages.count(page))
+        return Underlying->readBytes(address, dest, size);
+
+    // Fetch any missing pages, coalescing each contiguous run of misses into
+    // a single underlying read so a multi-page request costs one round trip.
+    for (uint64_t page = firstPage; page <= lastPage;) {
+      if (Pages.count(page)) {
+        page += PageSize;
+        continue;
+      }
+      uint64_t runEnd = page + PageSize;
+      while (runEnd <= lastPage && !Pages.count(runEnd))
+        runEnd += PageSize;
+      if (!fetchPages(page, runEnd)) {
+        // The page-granular fetch failed even though the requested range
+        // itself may be readable; fall back to an exact read.
+        for (uint64_t bad = page; bad < runEnd; bad += PageSize)
+          UnreadablePages.insert(bad);
+        return Underlying->readBytes(address, dest, size);
+      }
+      page = runEnd;
+    }
+
+    // Serve the read from the cache.
+    for (uint64_t page = firstPage; page <= lastPage; page += PageSize) {
+      uint64_t begin = std::max(addr, page);
+      uint64_t end = std::min(addr + size, page + PageSize);
+      memcpy(dest + (begin - addr), Pages[page].get() + (begin - page),
+             end - begin);
+    }
+    return true;
+  }
+
+private:
+  /// Read the pages in [begin, end) from the underlying reader in one call
+  /// and enter them into the cache.
+  bool fetchPages(uint64_t begin, uint64_t end) {
+    auto buffer = std::make_unique<uint8_t[]>(end - begin);
+    if (!Underlying->readBytes(RemoteAddress(begin), buffer.get(),
+                               end - begin))
+      return false;
+    for (uint64_t page = begin; page < end; page += PageSize) {
+      auto pageBuffer = std::make_unique<uint8_t[]>(PageSize);
+      memcpy(pageBuffer.get(), buffer.get() + (page - begin), PageSize);
+      Pages.emplace(page, std::move(pageBuffer));
+    }
+    return true;
+  }
+};
+
+} // end namespace remote
+} // end namespace swift
+
+#endif // SWIFT_REMOTE_CACHINGMEMORYREADER_H
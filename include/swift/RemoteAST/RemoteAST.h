@@ -27,6 +27,7 @@
 #include "llvm/ADT/StringRef.h"
 
 #include <memory>
+#include <vector>
 
 namespace swift {
 class ASTContext;
@@ -193,6 +194,19 @@ public:
   getTypeForRemoteTypeMetadata(remote::RemoteAddress address,
                                bool skipArtificial = false);
 
+  /// Resolve a batch of supposed type metadata addresses in one call.
+  ///
+  /// Resolutions are memoized by address for the lifetime of this context,
+  /// so clients which issue many queries per debugger stop should gather
+  /// the metadata pointers they need and resolve them through one context
+  /// rather than paying the demangle-and-walk cost per pointer.
+  ///
+  /// The result vector parallels \p addresses; each element succeeds or
+  /// fails independently, exactly as getTypeForRemoteTypeMetadata would.
+  std::vector<Result<Type>>
+  getTypesForRemoteTypeMetadata(ArrayRef<remote::RemoteAddress> addresses,
+                                bool skipArtificial = false);
+
   /// Given an address which is supposedly of type metadata, try to
   /// resolve it to a specific MetadataKind value for its backing type.
   Result<MetadataKind>
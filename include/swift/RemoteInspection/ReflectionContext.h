@@ -127,6 +127,14 @@ class ReflectionContext
                  const RecordTypeInfo *>
       Cache;
 
+  /// Capture descriptors decoded so far, keyed by the descriptor's remote
+  /// address. The decoded info is object-independent; only the metadata-source
+  /// resolution performed per instance reads from the object. A nullopt entry
+  /// records that the descriptor could not be found.
+  llvm::DenseMap<typename super::StoredPointer,
+                 std::optional<ClosureContextInfo>>
+      CaptureInfoCache;
+
   /// All buffers we need to keep around long term. This will automatically free them
   /// when this object is destroyed.
   std::vector<MemoryReader::ReadBytesResult> savedBuffers;
@@ -1023,14 +1031,21 @@ public:
       //
       // Non-generic SIL boxes share metadata among types with compatible
       // layout, but we need some way to get an outgoing pointer map for them.
-      auto CD = getBuilder().getCaptureDescriptor(
-                                CDAddr->getResolvedAddress().getAddressData());
-      if (CD == nullptr)
+      auto CDRemoteAddr = CDAddr->getResolvedAddress().getAddressData();
+      auto CachedInfo = CaptureInfoCache.find(CDRemoteAddr);
+      if (CachedInfo == CaptureInfoCache.end()) {
+        std::optional<ClosureContextInfo> Info;
+        auto CD = getBuilder().getCaptureDescriptor(CDRemoteAddr);
+        if (CD != nullptr)
+          Info = getBuilder().getClosureContextInfo(CD);
+        CachedInfo =
+            CaptureInfoCache.insert({CDRemoteAddr, std::move(Info)}).first;
+      }
+      if (!CachedInfo->second)
         return nullptr;
 
-      auto Info = getBuilder().getClosureContextInfo(CD);
-
-      return getClosureContextInfo(ObjectAddress, Info, ExternalTypeInfo);
+      return getClosureContextInfo(ObjectAddress, *CachedInfo->second,
+                                   ExternalTypeInfo);
     }
 
     case MetadataKind::HeapGenericLocalVariable: {
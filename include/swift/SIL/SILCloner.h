@@ -12,6 +12,13 @@
 //
 // This file defines the SILCloner class, used for cloning SIL instructions.
 //
+// Cloning is eager and allocates real instructions in the target function:
+// there is no copy-on-write or rollback facility. Passes are therefore
+// expected to make their profitability and legality decisions *before*
+// cloning (as ClosureSpecializer, the generic specializer, and the loop
+// transforms do), rather than cloning speculatively and discarding the
+// result.
+//
 //===----------------------------------------------------------------------===//
 
 #ifndef SWIFT_SIL_SILCLONER_H
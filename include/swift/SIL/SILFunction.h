@@ -353,6 +353,13 @@ private:
   /// block indices.
   unsigned BlockListChangeIdx = 0;
 
+  /// The number of instructions the serialized body of this function
+  /// contained, as recorded in the module file it was deserialized from.
+  /// Zero if the function was not deserialized or the size is unknown.
+  /// Unlike walking the instruction list, this is available for functions
+  /// whose bodies have not been deserialized yet.
+  unsigned SerializedInstructionCount = 0;
+
   /// The isolation of this function.
   ActorIsolation actorIsolation = ActorIsolation::forUnspecified();
 
@@ -734,6 +741,16 @@ public:
     WasDeserializedCanonical = val;
   }
 
+  /// Returns the instruction count recorded for this function in the module
+  /// file it was deserialized from, or 0 if unknown.
+  unsigned getSerializedInstructionCount() const {
+    return SerializedInstructionCount;
+  }
+
+  void setSerializedInstructionCount(unsigned count) {
+    SerializedInstructionCount = count;
+  }
+
   ForceEnableLexicalLifetimes_t forceEnableLexicalLifetimes() const {
     return ForceEnableLexicalLifetimes_t(ForceEnableLexicalLifetimes);
   }
@@ -40,6 +40,7 @@
 #include "swift/SILOptimizer/Utils/DebugOptUtils.h"
 #include "swift/SILOptimizer/Utils/InstOptUtils.h"
 #include "llvm/ADT/DenseMap.h"
+#include "llvm/ADT/SmallPtrSet.h"
 #include "llvm/ADT/SmallVector.h"
 
 namespace swift {
@@ -67,6 +68,12 @@ template <typename VectorT = std::vector<SILInstruction *>,
 class SILInstructionWorklist : SILInstructionWorklistBase {
   BlotSetVector<SILInstruction *, VectorT, MapT> worklist;
 
+  /// If non-null, the parent blocks of instructions added to the worklist
+  /// are recorded here. This lets a client that runs repeated fixpoint
+  /// iterations re-seed the worklist from just the blocks that changed,
+  /// rather than rescanning the whole function.
+  llvm::SmallPtrSetImpl<SILBasicBlock *> *changedBlockCollector = nullptr;
+
   void operator=(const SILInstructionWorklist &rhs) = delete;
   SILInstructionWorklist(const SILInstructionWorklist &worklist) = delete;
 
@@ -74,6 +81,14 @@ public:
   SILInstructionWorklist(const char *loggingName = "InstructionWorklist")
       : SILInstructionWorklistBase(loggingName) {}
 
+  /// Record the parent blocks of subsequently added instructions in
+  /// \p collector. Instructions added via addInitialGroup() are not
+  /// recorded; they seed the worklist rather than react to a change.
+  void setChangedBlockCollector(
+      llvm::SmallPtrSetImpl<SILBasicBlock *> *collector) {
+    changedBlockCollector = collector;
+  }
+
   /// Returns true if the worklist is empty.
   bool isEmpty() const { return worklist.empty(); }
 
@@ -82,6 +97,10 @@ public:
 
   /// Add the specified instruction to the worklist if it isn't already in it.
   void add(SILInstruction *instruction) {
+    if (changedBlockCollector) {
+      if (auto *parent = instruction->getParent())
+        changedBlockCollector->insert(parent);
+    }
     if (worklist.insert(instruction).second) {
       withDebugStream([&](llvm::raw_ostream &stream, StringRef loggingName) {
         stream << loggingName << ": ADD: " << *instruction << '\n';
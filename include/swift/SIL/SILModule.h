@@ -202,7 +202,22 @@ private:
 
   /// The list of freed slabs, which can be reused.
   SlabList freeSlabs;
-  
+
+  /// Alignment guaranteed for instruction allocations, and the size of the
+  /// per-allocation header recording the size class for recycling.
+  static constexpr unsigned instAlignment = 16;
+
+  /// Instruction allocations are bucketed into size classes of this many
+  /// bytes; allocations larger than the last bucket are not recycled.
+  static constexpr unsigned instSizeClassGranularity = 8;
+  static constexpr unsigned numInstFreeLists = 64;
+
+  /// Size-class free lists recycling the memory of deleted instructions.
+  /// High-churn passes create and delete instructions in large numbers, and
+  /// returning that memory to malloc only to request it back immediately
+  /// shows up both in time and in RSS spikes.
+  mutable llvm::SmallVector<char *, 4> instFreeLists[numInstFreeLists];
+
   /// For consistency checking.
   size_t numAllocatedSlabs = 0;
 
@@ -231,6 +246,14 @@ private:
   llvm::StringMap<SILFunction *> FunctionTable;
   llvm::StringMap<SILFunction *> ZombieFunctionTable;
 
+  /// Memoized results of SILDeclRef::mangle() with the default mangling kind.
+  /// Mangling is deterministic for a given declaration reference, but every
+  /// reference to a function re-derives its name before the lookup in
+  /// \p FunctionTable, which adds up over a whole module's call sites. The
+  /// names are allocated on the module's allocator so the cached StringRefs
+  /// stay valid across rehashing.
+  llvm::DenseMap<SILDeclRef, StringRef> MangledNameCache;
+
   /// The list of SILFunctions in the module.
   FunctionListType functions;
 
@@ -774,6 +797,11 @@ public:
     return FunctionTable.lookup(name);
   }
 
+  /// Return the mangled name of \p constant with the default mangling kind,
+  /// memoizing the result. The returned string is allocated on the module's
+  /// allocator and stays valid for the lifetime of the module.
+  StringRef getMangledName(SILDeclRef constant);
+
   /// Look for a function by declaration.
   ///
   /// \return null if this module has no such function
@@ -1009,8 +1037,14 @@ public:
   }
 
   /// Allocate memory for an instruction using the module's internal allocator.
+  /// Deleted instructions' memory is recycled through per-size-class free
+  /// lists, so this is cheap even for passes with heavy instruction churn.
   void *allocateInst(unsigned Size, unsigned Align) const;
 
+  /// Return instruction memory obtained from \p allocateInst to the
+  /// module's free lists.
+  void deallocateInst(SILInstruction *I);
+
   /// Called before \p I is removed from its basic block and scheduled for
   /// deletion.
   void willDeleteInstruction(SILInstruction *I);
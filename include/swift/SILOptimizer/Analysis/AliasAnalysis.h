@@ -55,6 +55,8 @@ public:
     MustAlias,      ///< The two values are equal.
   };
 
+  using TBAACacheKey = std::pair<SILType, SILType>;
+
 private:
   /// A key used for the AliasAnalysis cache.
   ///
@@ -73,16 +75,16 @@ private:
 
   using ScopeCacheKey = std::pair<SILInstruction *, SILInstruction *>;
 
-  using TBAACacheKey = std::pair<SILType, SILType>;
-
   SILPassManager *PM;
 
   /// A cache for the computation of TBAA. True means that the types may
   /// alias. False means that the types must not alias.
   ///
   /// We don't need to invalidate this cache because type aliasing relations
-  /// never change.
-  llvm::DenseMap<TBAACacheKey, bool> TypesMayAliasCache;
+  /// never change; it is owned by the analysis container and shared across
+  /// all AliasAnalysis instances so that it also survives function
+  /// invalidation.
+  llvm::DenseMap<TBAACacheKey, bool> &TypesMayAliasCache;
 
   /// AliasAnalysis value cache.
   ///
@@ -131,7 +133,9 @@ private:
   bool isInImmutableScope(SILInstruction *inst, SILValue V);
 
 public:
-  AliasAnalysis(SILPassManager *PM) : PM(PM) {}
+  AliasAnalysis(SILPassManager *PM,
+                llvm::DenseMap<TBAACacheKey, bool> &typesMayAliasCache)
+      : PM(PM), TypesMayAliasCache(typesMayAliasCache) {}
 
   ~AliasAnalysis();
 
@@ -2261,6 +2261,18 @@ private:
                  std::pair<VarDecl *, BraceStmt *>>
       BuilderTransformedBodies;
 
+  /// The *global* set of all functions whose bodies contain a construct
+  /// a particular result builder cannot handle, together with the first
+  /// such construct.
+  ///
+  /// Like \c BuilderTransformedBodies this persists across solver scopes,
+  /// so re-attempting the same builder under a different outer overload
+  /// choice doesn't re-run the transform just to rediscover the
+  /// unsupported element.
+  llvm::DenseMap<std::pair<AnyFunctionRef, NominalTypeDecl *>,
+                 SkipUnhandledConstructInResultBuilder::UnhandledNode>
+      UnsupportedBuilderBodies;
+
   /// Arguments after the code completion token that were thus ignored (i.e.
   /// assigned fresh type variables) for type checking.
   llvm::SetVector<Expr *> IgnoredArguments;
@@ -5436,6 +5448,12 @@ public:
              FreeTypeVariableBinding allowFreeTypeVariables =
                  FreeTypeVariableBinding::Disallow);
 
+  /// Compute a digest of the structural shape of the generated constraints
+  /// (constraint kinds and locator paths, but not specific types or
+  /// declarations). Structurally identical expressions in different
+  /// locations produce the same digest.
+  uint64_t getConstraintShapeDigest() const;
+
   /// Solve the system of constraints.
   ///
   /// \param allowFreeTypeVariables How to bind free type variables in
@@ -13,6 +13,7 @@
 #define SWIFT_SERIALIZATION_H
 
 #include "swift/Subsystems.h"
+#include "llvm/ADT/SmallVector.h"
 
 namespace swift {
 
@@ -26,6 +27,14 @@ void writeToStream(
     const SerializationOptions &options,
     const fine_grained_dependencies::SourceFileDepGraph *DepGraph);
 
+/// Serialize a module and return the serialized bits directly. Unlike
+/// \c writeToStream, this hands the serializer's own buffer to the caller,
+/// so the module image is never duplicated in memory.
+llvm::SmallVector<char, 0> writeToBuffer(
+    ModuleOrSourceFile DC, const SILModule *M,
+    const SerializationOptions &options,
+    const fine_grained_dependencies::SourceFileDepGraph *DepGraph);
+
 /// Serialize module documentation to the given stream.
 void writeDocToStream(raw_ostream &os, ModuleOrSourceFile DC,
                       StringRef GroupInfoPath);
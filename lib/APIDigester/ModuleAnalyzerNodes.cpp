@@ -1028,7 +1028,13 @@ static bool isSDKNodeEqual(SDKContext &Ctx, const SDKNode &L, const SDKNode &R)
 }
 
 bool SDKContext::isEqual(const SDKNode &Left, const SDKNode &Right) {
-  return isSDKNodeEqual(*this, Left, Right);
+  auto Key = std::make_pair(&Left, &Right);
+  auto Found = EqualCache.find(Key);
+  if (Found != EqualCache.end())
+    return Found->second;
+  bool Result = isSDKNodeEqual(*this, Left, Right);
+  EqualCache[Key] = Result;
+  return Result;
 }
 
 AccessLevel SDKContext::getAccessLevel(const ValueDecl *VD) const {
@@ -49,23 +49,6 @@ static AccessorKind unbridged(BridgedAccessorKind kind) {
 // MARK: Identifier
 //===----------------------------------------------------------------------===//
 
-BridgedDeclBaseName BridgedDeclBaseName_createConstructor() {
-  return DeclBaseName::createConstructor();
-}
-
-BridgedDeclBaseName BridgedDeclBaseName_createDestructor() {
-  return DeclBaseName::createDestructor();
-}
-
-BridgedDeclBaseName BridgedDeclBaseName_createSubscript() {
-  return DeclBaseName::createSubscript();
-}
-
-BridgedDeclBaseName
-BridgedDeclBaseName_createIdentifier(BridgedIdentifier identifier) {
-  return DeclBaseName(identifier.unbridged());
-}
-
 BridgedDeclNameRef
 BridgedDeclNameRef_createParsed(BridgedASTContext cContext,
                                 BridgedDeclBaseName cBaseName,
@@ -78,11 +61,6 @@ BridgedDeclNameRef_createParsed(BridgedASTContext cContext,
   return DeclNameRef(DeclName(context, cBaseName.unbridged(), labels));
 }
 
-BridgedDeclNameRef
-BridgedDeclNameRef_createParsed(BridgedDeclBaseName cBaseName) {
-  return DeclNameRef(cBaseName.unbridged());
-}
-
 BridgedDeclNameLoc BridgedDeclNameLoc_createParsed(
     BridgedASTContext cContext, BridgedSourceLoc cBaseNameLoc,
     BridgedSourceLoc cLParenLoc, BridgedArrayRef cLabelLocs,
@@ -97,11 +75,6 @@ BridgedDeclNameLoc BridgedDeclNameLoc_createParsed(
                      labelLocs, cRParenLoc.unbridged());
 }
 
-BridgedDeclNameLoc
-BridgedDeclNameLoc_createParsed(BridgedSourceLoc cBaseNameLoc) {
-  return DeclNameLoc(cBaseNameLoc.unbridged());
-}
-
 //===----------------------------------------------------------------------===//
 // MARK: ASTContext
 //===----------------------------------------------------------------------===//
@@ -338,10 +311,6 @@ void BridgedDiagnostic_finish(BridgedDiagnostic cDiag) {
 // MARK: DeclContexts
 //===----------------------------------------------------------------------===//
 
-bool BridgedDeclContext_isLocalContext(BridgedDeclContext cDeclContext) {
-  return cDeclContext.unbridged()->isLocalContext();
-}
-
 BridgedPatternBindingInitializer
 BridgedPatternBindingInitializer_create(BridgedDeclContext cDeclContext) {
   return PatternBindingInitializer::create(cDeclContext.unbridged());
@@ -1732,19 +1701,10 @@ BridgedUnresolvedPatternExpr_createParsed(BridgedASTContext cContext,
   return new (cContext.unbridged()) UnresolvedPatternExpr(cPattern.unbridged());
 }
 
-void BridgedExpr_setImplicit(BridgedExpr cExpr) {
-  cExpr.unbridged()->setImplicit();
-}
-
 //===----------------------------------------------------------------------===//
 // MARK: Stmts
 //===----------------------------------------------------------------------===//
 
-BridgedStmtConditionElement
-BridgedStmtConditionElement_createBoolean(BridgedExpr expr) {
-  return StmtConditionElement(expr.unbridged());
-}
-
 BridgedStmtConditionElement BridgedStmtConditionElement_createPatternBinding(
     BridgedASTContext cContext, BridgedSourceLoc cIntroducerLoc,
     BridgedPattern cPattern, BridgedExpr cInitializer) {
@@ -2451,14 +2411,6 @@ BridgedTypedPattern_createPropagated(BridgedASTContext cContext,
       cContext.unbridged(), cPattern.unbridged(), cType.unbridged());
 }
 
-void BridgedPattern_setImplicit(BridgedPattern cPattern) {
-  cPattern.unbridged()->setImplicit();
-}
-
-BridgedIdentifier BridgedPattern_getBoundName(BridgedPattern cPattern) {
-  return cPattern.unbridged()->getBoundName();
-}
-
 //===----------------------------------------------------------------------===//
 // MARK: Misc
 //===----------------------------------------------------------------------===//
@@ -2637,3 +2589,25 @@ bool Plugin_waitForNextMessage(PluginHandle handle, BridgedData *out) {
   *out = BridgedData{(const char *)outPtr, size};
   return false;
 }
+
+bool Plugin_lookupCachedExpansion(PluginHandle handle,
+                                  const BridgedData request,
+                                  BridgedData *response) {
+  auto *plugin = static_cast<LoadedExecutablePlugin *>(handle);
+  auto cached = plugin->lookupCachedExpansion(
+      StringRef(request.BaseAddress, request.Length));
+  if (!cached)
+    return false;
+  auto size = cached->size();
+  auto outPtr = malloc(size);
+  memcpy(outPtr, cached->data(), size);
+  *response = BridgedData{(const char *)outPtr, size};
+  return true;
+}
+
+void Plugin_cacheExpansion(PluginHandle handle, const BridgedData request,
+                           const BridgedData response) {
+  auto *plugin = static_cast<LoadedExecutablePlugin *>(handle);
+  plugin->cacheExpansion(StringRef(request.BaseAddress, request.Length),
+                         StringRef(response.BaseAddress, response.Length));
+}
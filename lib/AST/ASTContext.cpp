@@ -274,6 +274,9 @@ struct ASTContext::Implementation {
 
   // FIXME: This is a StringMap rather than a StringSet because StringSet
   // doesn't allow passing in a pre-existing allocator.
+  //
+  // Note that this table is only ever accessed from the thread that owns the
+  // ASTContext, so it is unsynchronized by design.
   llvm::StringMap<Identifier::Aligner, llvm::BumpPtrAllocator&>
   IdentifierTable;
 
@@ -673,7 +676,9 @@ struct ASTContext::Implementation {
 };
 
 ASTContext::Implementation::Implementation()
-    : IdentifierTable(Allocator),
+    // Even small compilations intern thousands of identifiers, so start the
+    // table large enough to skip the first several rehash-and-grow cycles.
+    : IdentifierTable(4096, Allocator),
       IntrinsicScratchContext(new llvm::LLVMContext()) {}
 ASTContext::Implementation::~Implementation() {
   for (auto &cleanup : Cleanups)
@@ -856,8 +861,7 @@ Identifier ASTContext::getIdentifier(StringRef Str) const {
   if (Str.data() == nullptr)
     return Identifier(nullptr);
 
-  auto pair = std::make_pair(Str, Identifier::Aligner());
-  auto I = getImpl().IdentifierTable.insert(pair).first;
+  auto I = getImpl().IdentifierTable.try_emplace(Str).first;
   return Identifier(I->getKeyData());
 }
 
@@ -26,6 +26,7 @@
 #include "swift/AST/ProtocolConformance.h"
 #include "swift/AST/ProtocolConformanceRef.h"
 #include "swift/AST/TypeCheckRequests.h"
+#include "swift/Basic/Statistic.h"
 #include "llvm/Support/SaveAndRestore.h"
 
 using namespace swift;
@@ -124,6 +125,9 @@ void ConformanceLookupTable::ConformanceEntry::dump(raw_ostream &os,
 }
 
 ConformanceLookupTable::ConformanceLookupTable(ASTContext &ctx) {
+  if (auto *stats = ctx.Stats)
+    ++stats->getFrontendCounters().NumConformanceLookupTables;
+
   // Register a cleanup with the ASTContext to call the conformance
   // table destructor.
   ctx.addCleanup([this]() {
@@ -415,10 +419,12 @@ void ConformanceLookupTable::updateLookupTable(NominalTypeDecl *nominal,
                    });
 
     if (anyChanged) {
-      // Compute the conformances for each protocol.
+      // Compute the conformances for each protocol that has gained entries
+      // since it was last resolved; untouched entry lists cannot change
+      // their resolution.
       bool anySuperseded = false;
-      for (const auto &entry : Conformances) {
-        if (resolveConformances(entry.first))
+      for (auto *protocol : UnresolvedProtocols.takeVector()) {
+        if (resolveConformances(protocol))
           anySuperseded = true;
       }
 
@@ -502,6 +508,7 @@ bool ConformanceLookupTable::addProtocol(ProtocolDecl *protocol, SourceLoc loc,
   /// Build the conformance entry (if it hasn't been built before).
   ConformanceEntry *entry = new (ctx) ConformanceEntry(loc, protocol, source);
   conformanceEntries.push_back(entry);
+  UnresolvedProtocols.insert(protocol);
 
   // Record this as a conformance within the given declaration
   // context.
@@ -766,6 +773,10 @@ ConformanceLookupTable::Ordering ConformanceLookupTable::compareConformances(
 }
 
 bool ConformanceLookupTable::resolveConformances(ProtocolDecl *protocol) {
+  // This protocol's entries are about to be brought up to date; remove it
+  // before resolving, so that any entries added mid-resolution re-mark it.
+  UnresolvedProtocols.remove(protocol);
+
   // Find any entries that are superseded by other entries.
   ConformanceEntries &entries = Conformances[protocol];
   llvm::SmallPtrSet<DeclContext *, 4> knownConformances;
@@ -1072,6 +1083,7 @@ void ConformanceLookupTable::registerProtocolConformance(
 
   // Record that this type conforms to the given protocol.
   Conformances[protocol].push_back(entry);
+  UnresolvedProtocols.insert(protocol);
 
   // Record this as a conformance within the given declaration
   // context.
@@ -1097,9 +1109,12 @@ bool ConformanceLookupTable::lookupConformance(
       return false;
   }
 
-  // Resolve the conformances for this protocol.
+  // Resolve the conformances for this protocol. This may add entries for
+  // other protocols, so re-find the entry list instead of reusing the
+  // iterator from above.
   resolveConformances(protocol);
-  for (auto entry : Conformances[protocol]) {
+  known = Conformances.find(protocol);
+  for (auto entry : known->second) {
     if (auto conformance = getConformance(nominal, entry)) {
       conformances.push_back(conformance);
     }
@@ -358,6 +358,14 @@ class ConformanceLookupTable : public ASTAllocated<ConformanceLookupTable> {
   /// The conformance table.
   ConformanceTable Conformances;
 
+  /// The protocols whose entry lists have gained entries since the last
+  /// call to resolveConformances() for them.
+  ///
+  /// Resolution only compares the entries within a single protocol's list,
+  /// so the Resolved stage can limit itself to these protocols instead of
+  /// re-resolving the entire table whenever a new extension shows up.
+  llvm::SmallSetVector<ProtocolDecl *, 4> UnresolvedProtocols;
+
   typedef llvm::SmallVector<ProtocolDecl *, 2> ProtocolList;
 
   /// List of all of the protocols to which a given context declares
@@ -278,7 +278,11 @@ bool swift::fine_grained_dependencies::readFineGrainedDependencyGraph(
 
 bool swift::fine_grained_dependencies::readFineGrainedDependencyGraph(
      StringRef path, SourceFileDepGraph &g) {
-  auto buffer = llvm::MemoryBuffer::getFile(path);
+  // Bitcode never looks for a null terminator, and requiring one forces a
+  // read of the whole file up front whenever its size is a multiple of the
+  // page size. Without it the buffer can be mmapped and paged in on demand.
+  auto buffer = llvm::MemoryBuffer::getFile(path, /*IsText=*/false,
+                                            /*RequiresNullTerminator=*/false);
   if (!buffer)
     return false;
 
@@ -351,10 +351,61 @@ GenericSignatureImpl::lookupConformance(CanType type,
   return M->lookupConformance(type, proto, /*allowMissing=*/true);
 }
 
+/// Whether simple queries on \p sig can be answered by inspecting its
+/// requirement list alone, without building a requirement machine.
+///
+/// This is the case as long as no requirement can introduce derived
+/// conformances or layout constraints on another subject: every subject must
+/// be a generic parameter (so there are no nested types to resolve), and
+/// there must be no same-type or superclass requirements, which can imply
+/// further requirements via concrete types. Conformance and layout
+/// requirements on a generic parameter only ever constrain that parameter.
+static bool canAnswerQueriesFromRequirements(CanGenericSignature sig) {
+  for (const auto &req : sig.getRequirements()) {
+    if (!isa<GenericTypeParamType>(req.getFirstType()->getCanonicalType()))
+      return false;
+
+    switch (req.getKind()) {
+    case RequirementKind::Conformance:
+    case RequirementKind::Layout:
+      break;
+    case RequirementKind::Superclass:
+    case RequirementKind::SameType:
+    case RequirementKind::SameShape:
+      return false;
+    }
+  }
+  return true;
+}
+
 bool GenericSignatureImpl::requiresClass(Type type) const {
   assert(type->isTypeParameter() &&
          "Only type parameters can have superclass requirements");
 
+  // Fast path: if the requirement machine was not built yet and the signature
+  // is simple enough, answer from the requirement list instead of paying for
+  // Knuth-Bendix completion.
+  if (!Machine) {
+    auto canSig = getCanonicalSignature();
+    if (canAnswerQueriesFromRequirements(canSig)) {
+      if (auto *param =
+              dyn_cast<GenericTypeParamType>(type->getCanonicalType())) {
+        for (const auto &req : canSig.getRequirements()) {
+          if (!req.getFirstType()->isEqual(param))
+            continue;
+
+          if (req.getKind() == RequirementKind::Layout &&
+              req.getLayoutConstraint()->isClass())
+            return true;
+          if (req.getKind() == RequirementKind::Conformance &&
+              req.getProtocolDecl()->requiresClass())
+            return true;
+        }
+        return false;
+      }
+    }
+  }
+
   return getRequirementMachine()->requiresClass(type);
 }
 
@@ -373,6 +424,27 @@ GenericSignature::RequiredProtocols
 GenericSignatureImpl::getRequiredProtocols(Type type) const {
   assert(type->isTypeParameter() && "Expected a type parameter");
 
+  // Fast path: read the conformance requirements off the canonical
+  // requirement list when no requirement machine is needed. The canonical
+  // list is already minimal, so it matches what the property map would
+  // produce after ProtocolType::canonicalizeProtocols().
+  if (!Machine) {
+    auto canSig = getCanonicalSignature();
+    if (canAnswerQueriesFromRequirements(canSig)) {
+      if (auto *param =
+              dyn_cast<GenericTypeParamType>(type->getCanonicalType())) {
+        GenericSignature::RequiredProtocols result;
+        for (const auto &req : canSig.getRequirements()) {
+          if (req.getKind() == RequirementKind::Conformance &&
+              req.getFirstType()->isEqual(param))
+            result.push_back(req.getProtocolDecl());
+        }
+        ProtocolType::canonicalizeProtocols(result);
+        return result;
+      }
+    }
+  }
+
   return getRequirementMachine()->getRequiredProtocols(type);
 }
 
@@ -380,6 +452,28 @@ bool GenericSignatureImpl::requiresProtocol(Type type,
                                             ProtocolDecl *proto) const {
   assert(type->isTypeParameter() && "Expected a type parameter");
 
+  // Fast path: check the conformance requirements and their inheritance
+  // closure directly. Invertible protocols are left to the machine, since
+  // conformances to them can be represented in more than one way.
+  if (!Machine && !proto->getInvertibleProtocolKind()) {
+    auto canSig = getCanonicalSignature();
+    if (canAnswerQueriesFromRequirements(canSig)) {
+      if (auto *param =
+              dyn_cast<GenericTypeParamType>(type->getCanonicalType())) {
+        for (const auto &req : canSig.getRequirements()) {
+          if (req.getKind() != RequirementKind::Conformance ||
+              !req.getFirstType()->isEqual(param))
+            continue;
+
+          auto *reqProto = req.getProtocolDecl();
+          if (reqProto == proto || reqProto->inheritsFrom(proto))
+            return true;
+        }
+        return false;
+      }
+    }
+  }
+
   return getRequirementMachine()->requiresProtocol(type, proto);
 }
 
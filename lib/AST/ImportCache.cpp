@@ -209,6 +209,15 @@ ImportCache::getImportSet(ASTContext &ctx,
   return *result;
 }
 
+void ImportCache::clear(const ModuleDecl *mod) {
+  for (auto it = ImportSetForDC.begin(); it != ImportSetForDC.end();) {
+    auto next = std::next(it);
+    if (it->first->getParentModule() == mod)
+      ImportSetForDC.erase(it);
+    it = next;
+  }
+}
+
 ImportSet &ImportCache::getImportSet(const DeclContext *dc) {
   dc = dc->getModuleScopeContext();
   auto *file = dyn_cast<FileUnit>(dc);
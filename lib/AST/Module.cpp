@@ -3227,7 +3227,7 @@ bool SourceFile::shouldCrossImport() const {
 }
 
 void ModuleDecl::clearLookupCache() {
-  getASTContext().getImportCache().clear();
+  getASTContext().getImportCache().clear(this);
 
   setIsObjCNameLookupCachePopulated(false);
   ObjCNameLookupCache.clear();
@@ -19,6 +19,7 @@
 #include "swift/AST/DiagnosticsSema.h"
 #include "swift/AST/SourceFile.h"
 #include "swift/Frontend/Frontend.h"
+#include "llvm/ADT/STLExtras.h"
 #include "llvm/CAS/CASProvidingFileSystem.h"
 #include "llvm/CAS/CachingOnDiskFileSystem.h"
 #include "llvm/Config/config.h"
@@ -684,6 +685,110 @@ bool SwiftDependencyScanningService::setupCachingDependencyScanningService(
   return false;
 }
 
+unsigned SwiftDependencyScanningService::removeDependenciesModifiedSince(
+    llvm::sys::TimePoint<> cutoff) {
+  llvm::sys::SmartScopedLock<true> Lock(ScanningServiceGlobalLock);
+  // Remapped paths cannot be consulted on the local filesystem.
+  if (hasPathMapping())
+    return 0;
+
+  // Memoize per-path staleness; the same interface or header is commonly an
+  // input of many cached modules.
+  llvm::StringMap<bool> modifiedPaths;
+  auto isModified = [&](StringRef path) -> bool {
+    if (path.empty())
+      return false;
+    auto known = modifiedPaths.find(path);
+    if (known != modifiedPaths.end())
+      return known->second;
+    // A file that can no longer be examined counts as modified.
+    bool modified = true;
+    llvm::sys::fs::file_status status;
+    if (!llvm::sys::fs::status(path, status))
+      modified = status.getLastModificationTime() > cutoff;
+    modifiedPaths.insert({path, modified});
+    return modified;
+  };
+
+  auto definingInputsModified = [&](const ModuleDependencyInfo &info) -> bool {
+    if (auto *detail = info.getAsSwiftInterfaceModule())
+      return isModified(detail->swiftInterfaceFile) ||
+             llvm::any_of(detail->textualModuleDetails.bridgingSourceFiles,
+                          isModified);
+    if (auto *detail = info.getAsSwiftSourceModule())
+      return llvm::any_of(detail->sourceFiles, isModified) ||
+             llvm::any_of(detail->textualModuleDetails.bridgingSourceFiles,
+                          isModified);
+    if (auto *detail = info.getAsSwiftBinaryModule())
+      return isModified(detail->compiledModulePath) ||
+             llvm::any_of(detail->headerSourceFiles, isModified);
+    if (auto *detail = info.getAsClangModule())
+      return isModified(detail->moduleMapFile) ||
+             llvm::any_of(detail->fileDependencies, isModified);
+    // Placeholder dependencies are the client's responsibility to resolve;
+    // their inputs may legitimately not exist yet.
+    return false;
+  };
+
+  unsigned numRemoved = 0;
+  for (auto &contextEntry : ContextSpecificCacheMap) {
+    auto &contextCache = *contextEntry.getValue();
+
+    // Collect the entries whose own inputs changed.
+    ModuleDependencyIDSet invalidated;
+    for (auto &kindEntry : contextCache.ModuleDependenciesMap)
+      for (auto &moduleEntry : kindEntry.second)
+        if (definingInputsModified(moduleEntry.getValue()))
+          invalidated.insert({moduleEntry.getKey().str(), kindEntry.first});
+
+    if (invalidated.empty())
+      continue;
+
+    // Grow to a fixed point with every entry depending on an invalidated one:
+    // its recorded dependency set may no longer match what a fresh scan of
+    // the invalidated module would produce.
+    bool changed;
+    do {
+      changed = false;
+      for (auto &kindEntry : contextCache.ModuleDependenciesMap) {
+        for (auto &moduleEntry : kindEntry.second) {
+          ModuleDependencyID moduleID{moduleEntry.getKey().str(),
+                                      kindEntry.first};
+          if (invalidated.count(moduleID))
+            continue;
+          const auto &info = moduleEntry.getValue();
+          auto dependsOnInvalidated = [&](const ModuleDependencyID &depID) {
+            return invalidated.count(depID) != 0;
+          };
+          if ((info.isResolved() &&
+               llvm::any_of(info.getDirectModuleDependencies(),
+                            dependsOnInvalidated)) ||
+              llvm::any_of(info.getSwiftOverlayDependencies(),
+                           dependsOnInvalidated)) {
+            invalidated.insert(moduleID);
+            changed = true;
+          }
+        }
+      }
+    } while (changed);
+
+    // Erase the invalidated entries; they will be re-scanned on their next
+    // query.
+    for (const auto &moduleID : invalidated) {
+      auto kindMap = contextCache.ModuleDependenciesMap.find(moduleID.Kind);
+      if (kindMap != contextCache.ModuleDependenciesMap.end())
+        kindMap->second.erase(moduleID.ModuleName);
+    }
+    llvm::erase_if(contextCache.AllModules,
+                   [&](const ModuleDependencyID &moduleID) {
+                     return invalidated.count(moduleID) != 0;
+                   });
+    numRemoved += invalidated.size();
+  }
+
+  return numRemoved;
+}
+
 SwiftDependencyScanningService::ContextSpecificGlobalCacheState *
 SwiftDependencyScanningService::getCacheForScanningContextHash(StringRef scanningContextHash) const {
   auto contextSpecificCache = ContextSpecificCacheMap.find(scanningContextHash);
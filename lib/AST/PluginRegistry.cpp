@@ -17,8 +17,13 @@
 #include "swift/Basic/Program.h"
 #include "swift/Basic/Sandbox.h"
 #include "swift/Basic/StringExtras.h"
+#include "llvm/ADT/Statistic.h"
+#include "llvm/ADT/StringExtras.h"
 #include "llvm/Support/Endian.h"
 #include "llvm/Support/FileSystem.h"
+#include "llvm/Support/MemoryBuffer.h"
+#include "llvm/Support/Path.h"
+#include "llvm/Support/SHA256.h"
 #include "llvm/Support/raw_ostream.h"
 #include "llvm/Config/config.h"
 
@@ -40,6 +45,13 @@
 
 using namespace swift;
 
+#define DEBUG_TYPE "macro-expansion-cache"
+
+STATISTIC(NumMacroExpansionCacheHits,
+          "Number of macro expansions served from the on-disk cache");
+STATISTIC(NumMacroExpansionCacheMisses,
+          "Number of macro expansions that missed the on-disk cache");
+
 PluginRegistry::PluginRegistry() {
   dumpMessaging = ::getenv("SWIFT_DUMP_PLUGIN_MESSAGING") != nullptr;
 }
@@ -267,25 +279,25 @@ llvm::Error LoadedExecutablePlugin::sendMessage(llvm::StringRef message) const {
     llvm::dbgs() << "->(plugin:" << Process->process.Pid << ") " << message << '\n';
   }
 
-  const char *data = message.data();
   size_t size = message.size();
 
-  // Write header (message size).
+  // Write the header (message size) and the message in a single write.
+  // Writing them separately would make the plugin's header read wake up,
+  // return, and block again before the payload arrives, adding a scheduling
+  // round trip to every request.
   uint64_t header = llvm::support::endian::byte_swap(
       uint64_t(size), llvm::support::endianness::little);
-  writtenSize = Process->write(&header, sizeof(header));
-  if (writtenSize != sizeof(header)) {
-    setStale();
-    return llvm::createStringError(llvm::inconvertibleErrorCode(),
-                                   "failed to write plugin message header");
-  }
-
-  // Write message.
-  writtenSize = Process->write(data, size);
-  if (writtenSize != ssize_t(size)) {
+  llvm::SmallVector<char, 4096> buffer;
+  buffer.reserve(sizeof(header) + size);
+  buffer.append(reinterpret_cast<const char *>(&header),
+                reinterpret_cast<const char *>(&header) + sizeof(header));
+  buffer.append(message.begin(), message.end());
+
+  writtenSize = Process->write(buffer.data(), buffer.size());
+  if (writtenSize != ssize_t(buffer.size())) {
     setStale();
     return llvm::createStringError(llvm::inconvertibleErrorCode(),
-                                   "failed to write plugin message data");
+                                   "failed to write plugin message");
   }
 
   return llvm::Error::success();
@@ -307,20 +319,16 @@ llvm::Expected<std::string> LoadedExecutablePlugin::waitForNextMessage() const {
   size_t size = llvm::support::endian::read<uint64_t>(
       &header, llvm::support::endianness::little);
 
-  // Read message.
+  // Read the message directly into its final storage; the size is known
+  // from the header, so there is no need to stage it through a small
+  // intermediate buffer.
   std::string message;
-  message.reserve(size);
-  auto sizeToRead = size;
-  while (sizeToRead > 0) {
-    char buffer[4096];
-    readSize = Process->read(buffer, std::min(sizeof(buffer), sizeToRead));
-    if (readSize == 0) {
-      setStale();
-      return llvm::createStringError(llvm::inconvertibleErrorCode(),
-                                     "failed to read plugin message data");
-    }
-    sizeToRead -= readSize;
-    message.append(buffer, readSize);
+  message.resize(size);
+  readSize = Process->read(message.data(), size);
+  if (readSize != ssize_t(size)) {
+    setStale();
+    return llvm::createStringError(llvm::inconvertibleErrorCode(),
+                                   "failed to read plugin message data");
   }
 
   if (dumpMessaging) {
@@ -329,3 +337,74 @@ llvm::Expected<std::string> LoadedExecutablePlugin::waitForNextMessage() const {
 
   return message;
 }
+
+/// Return the directory of the on-disk macro expansion cache, specified by
+/// the 'SWIFT_MACRO_EXPANSION_CACHE_PATH' environment variable, or an empty
+/// string if caching is disabled.
+static StringRef getExpansionCacheDir() {
+  static const char *dir = ::getenv("SWIFT_MACRO_EXPANSION_CACHE_PATH");
+  return dir ? StringRef(dir) : StringRef();
+}
+
+std::string
+LoadedExecutablePlugin::expansionCacheEntryPath(llvm::StringRef request) {
+  StringRef cacheDir = getExpansionCacheDir();
+  if (cacheDir.empty())
+    return {};
+
+  // Key on the plugin executable and its modification time, so rebuilding a
+  // plugin invalidates all of its cached expansions, and on the full request
+  // message, which covers the macro name, the expansion input syntax, the
+  // lexical context, and the discriminator.
+  llvm::SHA256 hasher;
+  hasher.update(ExecutablePath);
+  auto mtime = LastModificationTime.time_since_epoch().count();
+  hasher.update(llvm::StringRef(reinterpret_cast<const char *>(&mtime),
+                                sizeof(mtime)));
+  hasher.update(request);
+
+  llvm::SmallString<128> path(cacheDir);
+  llvm::sys::path::append(
+      path, llvm::toHex(hasher.final(), /*LowerCase=*/true) + ".expansion");
+  return path.str().str();
+}
+
+std::optional<std::string>
+LoadedExecutablePlugin::lookupCachedExpansion(llvm::StringRef request) {
+  std::string path = expansionCacheEntryPath(request);
+  if (path.empty())
+    return std::nullopt;
+
+  auto buffer = llvm::MemoryBuffer::getFile(path);
+  if (!buffer) {
+    ++NumMacroExpansionCacheMisses;
+    return std::nullopt;
+  }
+
+  ++NumMacroExpansionCacheHits;
+  return (*buffer)->getBuffer().str();
+}
+
+void LoadedExecutablePlugin::cacheExpansion(llvm::StringRef request,
+                                            llvm::StringRef response) {
+  std::string path = expansionCacheEntryPath(request);
+  if (path.empty())
+    return;
+
+  // Failures below are ignored; the cache is purely an optimization.
+  if (llvm::sys::fs::create_directories(getExpansionCacheDir()))
+    return;
+
+  // Write to a temporary file and rename it into place so that concurrent
+  // compilations never observe a partially-written entry.
+  int tmpFD;
+  llvm::SmallString<128> tmpPath;
+  if (llvm::sys::fs::createUniqueFile(path + ".tmp-%%%%%%", tmpFD, tmpPath))
+    return;
+  {
+    llvm::raw_fd_ostream out(tmpFD, /*shouldClose=*/true);
+    out << response;
+  }
+  if (llvm::sys::fs::rename(tmpPath, path))
+    llvm::sys::fs::remove(tmpPath);
+}
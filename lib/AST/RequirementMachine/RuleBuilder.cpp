@@ -443,6 +443,16 @@ void RuleBuilder::addReferencedProtocol(const ProtocolDecl *proto) {
 /// Compute the transitive closure of the set of all protocols referenced from
 /// the right hand sides of conformance requirements, and import the rewrite
 /// rules from the requirement machine for each protocol component.
+///
+/// This is how rewrite system work is shared across generic signatures: each
+/// protocol connected component has a single requirement machine, built and
+/// completed once per ASTContext, and every downstream signature imports its
+/// already-confluent local rules here. Completion then only considers
+/// overlaps involving at least one local rule (see FirstLocalRule), so the
+/// imported rules are never re-completed against each other. Note that this
+/// sharing is per-invocation only; component machines for imported protocols
+/// are rebuilt from their deserialized, minimized requirement signatures,
+/// which is the serialized form of this information.
 void RuleBuilder::collectRulesFromReferencedProtocols() {
   // Compute the transitive closure.
   unsigned i = 0;
@@ -29,6 +29,16 @@
 
 namespace swift {
 
+/// The backing storage of a substitution map.
+///
+/// Storage is uniqued in the ASTContext: get() profiles the signature,
+/// replacement types and conformances into a FoldingSet, so two maps built
+/// from the same data share one allocation and pointer equality on
+/// SubstitutionMap is semantic equality. The profile deliberately ignores
+/// replacement entries for non-canonical generic parameters -- those are
+/// computed lazily by lookupSubstitution() and written back in place, and
+/// including them would let a populated map drift away from the profile it
+/// was interned under.
 class SubstitutionMap::Storage final
   : public llvm::FoldingSetNode,
     llvm::TrailingObjects<Storage, Type, ProtocolConformanceRef>
@@ -15,6 +15,7 @@
 //
 //===----------------------------------------------------------------------===//
 
+#include "swift/AST/ASTContext.h"
 #include "swift/AST/Decl.h"
 #include "swift/AST/ExistentialLayout.h"
 #include "swift/AST/GenericEnvironment.h"
@@ -25,6 +26,7 @@
 #include "swift/AST/ProtocolConformanceRef.h"
 #include "swift/AST/SubstitutionMap.h"
 #include "swift/AST/Types.h"
+#include "swift/Basic/Statistic.h"
 
 using namespace swift;
 
@@ -620,8 +622,46 @@ static Type substType(Type derivedType, unsigned level,
 
 Type Type::subst(SubstitutionMap substitutions,
                  SubstOptions options) const {
+  // Whole-type substitution through a substitution map is deterministic in
+  // (type, map storage, flags), so memoize it in the ASTContext. Skip the
+  // cache for solver-allocated types or maps, whose pointers are recycled
+  // when the constraint solver arena dies, and for substitutions carrying a
+  // tentative-witness callback, whose results depend on in-flight state.
+  bool cacheable = !substitutions.empty() &&
+                   !options.getTentativeTypeWitness &&
+                   !getPointer()->getRecursiveProperties().isSolverAllocated();
+  if (cacheable) {
+    for (Type replacement : substitutions.getReplacementTypesBuffer()) {
+      if (replacement &&
+          replacement->getRecursiveProperties().isSolverAllocated()) {
+        cacheable = false;
+        break;
+      }
+    }
+  }
+
+  if (!cacheable) {
+    InFlightSubstitutionViaSubMap IFS(substitutions, options);
+    return substType(*this, /*level=*/0, IFS);
+  }
+
+  auto &ctx = substitutions.getGenericSignature()->getASTContext();
+  auto key = std::make_tuple(getPointer(), substitutions.getOpaqueValue(),
+                             unsigned(options.toRaw()));
+  auto known = ctx.TypeSubstitutionResults.find(key);
+  if (known != ctx.TypeSubstitutionResults.end()) {
+    if (ctx.Stats)
+      ++ctx.Stats->getFrontendCounters().NumTypeSubstCacheHits;
+    return known->second;
+  }
+
   InFlightSubstitutionViaSubMap IFS(substitutions, options);
-  return substType(*this, /*level=*/0, IFS);
+  Type result = substType(*this, /*level=*/0, IFS);
+  if (ctx.Stats)
+    ++ctx.Stats->getFrontendCounters().NumTypeSubstCacheMisses;
+  if (result)
+    ctx.TypeSubstitutionResults.insert({key, result});
+  return result;
 }
 
 Type Type::subst(TypeSubstitutionFn substitutions,
@@ -579,7 +579,7 @@ func expandFreestandingMacroIPC(
     lexicalContext: pluginLexicalContext(of: expansionSyntax)
   )
   do {
-    let result = try macro.plugin.sendMessageAndWait(message)
+    let result = try macro.plugin.sendExpansionMessageAndWait(message)
     let expandedSource: String?
     let diagnostics: [PluginMessage.Diagnostic]
     switch result {
@@ -933,7 +933,7 @@ func expandAttachedMacroIPC(
   do {
     let expandedSource: String?
     let diagnostics: [PluginMessage.Diagnostic]
-    switch try macro.plugin.sendMessageAndWait(message) {
+    switch try macro.plugin.sendExpansionMessageAndWait(message) {
     case .expandMacroResult(let _expandedSource, let _diagnostics):
       expandedSource = _expandedSource
       diagnostics = _diagnostics
@@ -151,6 +151,54 @@ struct CompilerPlugin {
     }
   }
 
+  /// Send a macro expansion request, consulting the on-disk expansion cache
+  /// (enabled via the 'SWIFT_MACRO_EXPANSION_CACHE_PATH' environment
+  /// variable) before doing any IPC. Successful expansion responses are
+  /// added to the cache.
+  func sendExpansionMessageAndWait(_ message: HostToPluginMessage) throws -> PluginToHostMessage {
+    let request = try JSON.encode(message)
+
+    var cached = BridgedData()
+    let hasCached = request.withUnsafeBufferPointer { buffer in
+      Plugin_lookupCachedExpansion(
+        opaqueHandle,
+        BridgedData(baseAddress: buffer.baseAddress, count: buffer.count),
+        &cached
+      )
+    }
+    if hasCached {
+      defer { cached.free() }
+      let data = UnsafeBufferPointer(start: cached.baseAddress, count: cached.count)
+      return try data.withMemoryRebound(to: UInt8.self) { buffer in
+        try JSON.decode(PluginToHostMessage.self, from: buffer)
+      }
+    }
+
+    let response = try sendMessageAndWait(message)
+
+    // Only successful expansion responses are worth caching; anything else
+    // may depend on the state of the plugin process.
+    switch response {
+    case .expandMacroResult(let expandedSource, _),
+      .expandFreestandingMacroResult(let expandedSource, _):
+      guard expandedSource != nil, let encoded = try? JSON.encode(response) else {
+        break
+      }
+      request.withUnsafeBufferPointer { requestBuffer in
+        encoded.withUnsafeBufferPointer { responseBuffer in
+          Plugin_cacheExpansion(
+            opaqueHandle,
+            BridgedData(baseAddress: requestBuffer.baseAddress, count: requestBuffer.count),
+            BridgedData(baseAddress: responseBuffer.baseAddress, count: responseBuffer.count)
+          )
+        }
+      }
+    default:
+      break
+    }
+    return response
+  }
+
   /// Initialize the plugin. This should be called inside lock.
   func initialize() throws {
     // Send host capability and get plugin capability.
@@ -174,10 +174,6 @@ swift::areFilesDifferent(const llvm::Twine &source,
                          bool allowDestinationErrors) {
   namespace fs = llvm::sys::fs;
 
-  if (fs::equivalent(source, destination)) {
-    return FileDifference::IdenticalFile;
-  }
-
   OpenFileRAII sourceFile;
   fs::file_status sourceStatus;
   if (std::error_code error = fs::openFileForRead(source, sourceFile.fd)) {
@@ -210,6 +206,13 @@ swift::areFilesDifferent(const llvm::Twine &source,
     return convertDestinationError(error);
   }
 
+  // Compare the statuses we already have rather than asking the file system
+  // to resolve both paths again; every metadata operation here is a network
+  // round-trip on remote file systems.
+  if (fs::equivalent(sourceStatus, destStatus)) {
+    return FileDifference::IdenticalFile;
+  }
+
   uint64_t size = sourceStatus.getSize();
   if (size != destStatus.getSize()) {
     // If the files are different sizes, they must be different.
@@ -190,12 +190,13 @@ template <> struct ObjectTraits<Message> {
 } // namespace swift
 
 static void emitMessage(raw_ostream &os, Message &msg) {
-  std::string JSONString;
-  llvm::raw_string_ostream BufferStream(JSONString);
+  // The message has to be buffered since the protocol prefixes it with its
+  // length; use a stack buffer to keep typical messages off the heap.
+  SmallString<256> JSONString;
+  llvm::raw_svector_ostream BufferStream(JSONString);
   json::Output yout(BufferStream);
   yout << msg;
-  BufferStream.flush();
-  os << JSONString.length() << '\n';
+  os << JSONString.size() << '\n';
   os << JSONString << '\n';
 }
 
@@ -30,6 +30,7 @@
 #endif
 
 #if HAVE_UNISTD_H
+#include <fcntl.h>
 #include <unistd.h>
 #endif
 
@@ -88,6 +89,11 @@ struct Pipe {
     if (pipe(fds) == -1) {
       read = write = -1; // '-1' to inidicate the failure.
     }
+    // Mark both ends close-on-exec so other subprocesses spawned while this
+    // one is alive don't inherit them and keep the pipe open; the child's own
+    // copies are installed over stdin/stdout via dup2, which clears the flag.
+    fcntl(fds[0], F_SETFD, FD_CLOEXEC);
+    fcntl(fds[1], F_SETFD, FD_CLOEXEC);
     read = fds[0];
     write = fds[1];
   }
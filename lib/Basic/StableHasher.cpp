@@ -37,6 +37,35 @@ static inline void sip_round(uint64_t &v0, uint64_t &v1, uint64_t &v2,
 }
 } // end anonymous namespace
 
+void StableHasher::combine_bytes(const uint8_t *bits, uint64_t length) {
+  constexpr auto endian = llvm::support::endianness::little;
+
+  lengthAndByteCount += length;
+
+  // Top off any partially-filled inline buffer first.
+  uint64_t bufLen = getBufferLength();
+  if (bufLen > 0) {
+    const uint64_t nhead = std::min(length, sizeof(byteBuffer) - bufLen);
+    std::copy_n(bits, nhead, byteBuffer + bufLen);
+    bufLen += nhead;
+    bits += nhead;
+    length -= nhead;
+    if (bufLen < sizeof(byteBuffer)) {
+      return setBufferLength(bufLen);
+    }
+    compress(llvm::support::endian::read<uint64_t>(byteBuffer, endian));
+  }
+
+  // Compress directly from the input, eight bytes at a time.
+  for (; length >= sizeof(byteBuffer); bits += 8, length -= 8) {
+    compress(llvm::support::endian::read<uint64_t>(bits, endian));
+  }
+
+  // Reseed the buffer with the remaining bytes.
+  std::copy_n(bits, length, byteBuffer);
+  return setBufferLength(length);
+}
+
 void StableHasher::compress(uint64_t value) {
   state.v3 ^= value;
   for (unsigned i = 0; i < 2; ++i) {
@@ -17,6 +17,7 @@
 #include "llvm/ADT/DenseMap.h"
 #include "llvm/Config/config.h"
 #include "llvm/Support/FileSystem.h"
+#include "llvm/Support/JSON.h"
 #include "llvm/Support/Path.h"
 #include "llvm/Support/Process.h"
 #include "llvm/Support/SaveAndRestore.h"
@@ -98,6 +99,12 @@ makeTraceFileName(StringRef ProgramName,
   return makeFileName("trace", ProgramName, AuxName, "csv");
 }
 
+static std::string
+makeChromeTraceFileName(StringRef ProgramName,
+                        StringRef AuxName) {
+  return makeFileName("chrometrace", ProgramName, AuxName, "json");
+}
+
 static std::string
 makeProfileDirName(StringRef ProgramName,
                    StringRef AuxName) {
@@ -345,6 +352,7 @@ UnifiedStatsReporter::UnifiedStatsReporter(StringRef ProgramName,
     currentProcessExitStatus(EXIT_FAILURE),
     StatsFilename(Directory),
     TraceFilename(Directory),
+    ChromeTraceFilename(Directory),
     ProfileDirname(Directory),
     StartedTime(llvm::TimeRecord::getCurrentTime()),
     MainThreadID(std::this_thread::get_id()),
@@ -358,12 +366,16 @@ UnifiedStatsReporter::UnifiedStatsReporter(StringRef ProgramName,
 {
   path::append(StatsFilename, makeStatsFileName(ProgramName, AuxName));
   path::append(TraceFilename, makeTraceFileName(ProgramName, AuxName));
+  path::append(ChromeTraceFilename,
+               makeChromeTraceFileName(ProgramName, AuxName));
   path::append(ProfileDirname, makeProfileDirName(ProgramName, AuxName));
   EnableStatistics(/*PrintOnExit=*/false);
   if (TraceEvents || ProfileEvents || ProfileEntities)
     LastTracedFrontendCounters.emplace();
-  if (TraceEvents)
+  if (TraceEvents) {
     FrontendStatsEvents.emplace();
+    ChromeTraceEvents.emplace();
+  }
   if (ProfileEvents)
     EventProfilers =std::make_unique<StatsProfilers>();
   if (ProfileEntities)
@@ -643,6 +655,15 @@ UnifiedStatsReporter::saveAnyFrontendStatsEvents(
 #undef FRONTEND_STATISTIC
   }
 
+  if (ChromeTraceEvents) {
+    // Unlike the per-counter events above, record every tracer entry and
+    // exit so the region nesting survives into the duration trace.
+    auto NowUS = uint64_t(1000000.0 * Now.getProcessTime());
+    ChromeTraceEvents->emplace_back(FrontendStatsEvent{
+        NowUS, 0, IsEntry, T.EventName, StringRef(), 0, 0, T.Entity,
+        T.Formatter});
+  }
+
   // Save all counters (changed or otherwise).
   Last = Curr;
 }
@@ -758,6 +779,40 @@ UnifiedStatsReporter::flushTracesAndProfiles() {
     }
   }
 
+  if (ChromeTraceEvents && !ChromeTraceEvents->empty()) {
+    std::error_code EC;
+    raw_fd_ostream jstream(ChromeTraceFilename, EC, fs::OF_Append | fs::OF_Text);
+    if (EC) {
+      llvm::errs() << "Error opening chrome trace file '"
+                   << ChromeTraceFilename << "' for writing\n";
+      return;
+    }
+    auto Pid = static_cast<int64_t>(Process::getProcessId());
+    llvm::json::OStream J(jstream);
+    J.object([&] {
+      J.attributeArray("traceEvents", [&] {
+        for (auto const &E : *ChromeTraceEvents) {
+          J.object([&] {
+            J.attribute("ph", E.IsEntry ? "B" : "E");
+            J.attribute("ts", static_cast<int64_t>(E.TimeUSec));
+            J.attribute("pid", Pid);
+            J.attribute("tid", static_cast<int64_t>(1));
+            J.attribute("name", E.EventName);
+            if (E.IsEntry && E.Formatter) {
+              SmallString<64> EntityName;
+              llvm::raw_svector_ostream NOS(EntityName);
+              E.Formatter->traceName(E.Entity, NOS);
+              J.attributeObject("args", [&] {
+                J.attribute("entity", EntityName.str());
+              });
+            }
+          });
+        }
+      });
+    });
+    jstream << '\n';
+  }
+
   if (EventProfilers || EntityProfilers) {
     std::error_code EC = llvm::sys::fs::create_directories(ProfileDirname);
     if (EC) {
@@ -792,6 +847,7 @@ UnifiedStatsReporter::flushTracesAndProfiles() {
   }
   LastTracedFrontendCounters.reset();
   FrontendStatsEvents.reset();
+  ChromeTraceEvents.reset();
   EventProfilers.reset();
   EntityProfilers.reset();
 }
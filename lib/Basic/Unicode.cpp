@@ -15,6 +15,8 @@
 #include "llvm/ADT/SmallString.h"
 #include "llvm/ADT/SmallVector.h"
 #include "llvm/Support/ConvertUTF.h"
+#include <cstdint>
+#include <cstring>
 
 using namespace swift;
 
@@ -126,9 +128,43 @@ unsigned swift::unicode::extractFirstUnicodeScalar(StringRef S) {
   return Scalar;
 }
 
+size_t swift::unicode::countLeadingASCIIBytes(StringRef S) {
+  const char *Data = S.begin();
+  const char *End = S.end();
+  const char *Ptr = Data;
+
+  // Check a word at a time: a word contains a non-ASCII byte exactly when
+  // some byte has its high bit set.
+  while (End - Ptr >= ptrdiff_t(sizeof(uintptr_t))) {
+    uintptr_t Word;
+    memcpy(&Word, Ptr, sizeof(Word));
+    if (Word & (uintptr_t)UINTPTR_MAX / 0xFF * 0x80)
+      break;
+    Ptr += sizeof(Word);
+  }
+
+  // Finish off the tail (or locate the offending byte) one byte at a time.
+  while (Ptr != End && !(uint8_t(*Ptr) & 0x80))
+    ++Ptr;
+
+  return Ptr - Data;
+}
+
 bool swift::unicode::isWellFormedUTF8(StringRef S) {
-  const llvm::UTF8 *begin = S.bytes_begin();
-  return llvm::isLegalUTF8String(&begin, S.bytes_end());
+  while (!S.empty()) {
+    // ASCII prefixes are trivially well-formed; skip them in bulk.
+    S = S.drop_front(countLeadingASCIIBytes(S));
+    if (S.empty())
+      break;
+
+    // Decode one multi-byte sequence the slow way.
+    const llvm::UTF8 *Data = S.bytes_begin();
+    unsigned Step = llvm::getNumBytesForUTF8(*Data);
+    if (Step > S.size() || !llvm::isLegalUTF8Sequence(Data, Data + Step))
+      return false;
+    S = S.drop_front(Step);
+  }
+  return true;
 }
 
 std::string swift::unicode::sanitizeUTF8(StringRef Text) {
@@ -138,6 +174,16 @@ std::string swift::unicode::sanitizeUTF8(StringRef Text) {
   const llvm::UTF8* End = reinterpret_cast<const llvm::UTF8*>(Text.end());
   StringRef Replacement = SWIFT_UTF8("\ufffd");
   while (Data < End) {
+    // Copy ASCII runs wholesale; they never need replacement.
+    size_t ASCIILength = countLeadingASCIIBytes(
+        StringRef(reinterpret_cast<const char *>(Data), End - Data));
+    if (ASCIILength != 0) {
+      Builder.append(Data, Data + ASCIILength);
+      Data += ASCIILength;
+      if (Data == End)
+        break;
+    }
+
     auto Step = llvm::getNumBytesForUTF8(*Data);
     if (Data + Step > End) {
       Builder.append(Replacement);
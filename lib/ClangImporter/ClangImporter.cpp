@@ -2021,6 +2021,15 @@ bool ClangImporter::runPreprocessor(
   return emitInstance->getDiagnostics().hasErrorOccurred();
 }
 
+// Note on parallelism: this entry point builds exactly one PCM and is
+// designed to be driven as one frontend job per module, so independent
+// modules of an import graph can be precompiled concurrently by the build
+// system (the dependency scanner provides the module set and its
+// inter-module edges). Implicit module builds, by contrast, happen
+// recursively inside Clang while a header is being parsed and are
+// inherently serial within a single importer instance; clean-build
+// latency that is dominated by them is best addressed by switching to
+// explicitly-built modules rather than by threading this code.
 bool ClangImporter::emitPrecompiledModule(
     StringRef moduleMapPath, StringRef moduleName, StringRef outputPath) {
   auto emitInstance = cloneCompilerInstanceForPrecompiling();
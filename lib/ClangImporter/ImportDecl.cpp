@@ -2242,6 +2242,19 @@ namespace {
           continue;
         }
 
+        // A nested tag declaration with a linkage name can be found lazily
+        // through the module's SwiftLookupTable, so don't force it -- and
+        // everything its own members reference -- to be imported just because
+        // the outer record was touched. This only applies to plain C records;
+        // C++ records still import everything here because the method and
+        // accessor synthesis below needs the full member set.
+        if (!isa<clang::CXXRecordDecl>(decl)) {
+          if (auto *tag = dyn_cast<clang::TagDecl>(nd)) {
+            if (tag->hasNameForLinkage())
+              continue;
+          }
+        }
+
         if (auto field = dyn_cast<clang::FieldDecl>(nd)) {
           // Non-nullable pointers can't be zero-initialized.
           if (auto nullability =
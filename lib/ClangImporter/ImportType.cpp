@@ -50,9 +50,16 @@
 #include "clang/Sema/Lookup.h"
 #include "clang/Sema/Sema.h"
 #include "llvm/ADT/SmallString.h"
+#include "llvm/ADT/Statistic.h"
 #include "llvm/ADT/StringExtras.h"
 #include "llvm/Support/Compiler.h"
 
+#define DEBUG_TYPE "Import Type"
+STATISTIC(ImportTypeNumCacheHits,
+          "# of times the imported type cache was hit");
+STATISTIC(ImportTypeNumCacheMisses,
+          "# of times the imported type cache was missed");
+
 using namespace swift;
 using namespace importer;
 
@@ -1773,18 +1780,50 @@ ImportedType ClangImporter::Implementation::importType(
 
   clang::Qualifiers::ObjCLifetime objCLifetime = type.getObjCLifetime();
 
+  // Check whether this type has already been imported with the same options.
+  // Clang types are uniqued, so structurally identical occurrences across
+  // declarations share the same key.
+  std::optional<std::pair<const void *, uint64_t>> cacheKey;
+  if (!completionHandlerErrorParamIndex) {
+    uint64_t options = uint64_t(importKind);
+    options = (options << 8) | uint64_t(attrs.toRaw());
+    options = (options << 2) | uint64_t(bridging);
+    options = (options << 2) | uint64_t(optionality);
+    options = (options << 1) | uint64_t(allowNSUIntegerAsInt);
+    options = (options << 1) | uint64_t(resugarNSErrorPointer);
+    cacheKey = std::make_pair(type.getAsOpaquePtr(), options);
+
+    auto known = ImportedTypesCache.find(*cacheKey);
+    if (known != ImportedTypesCache.end()) {
+      ++ImportTypeNumCacheHits;
+      return known->second;
+    }
+    ++ImportTypeNumCacheMisses;
+  }
+
+  // Track whether importing this type produced any diagnostics; such imports
+  // must not be cached, since the diagnostics are attached per use site.
+  bool producedImportDiagnostic = false;
+  auto trackingDiagnosticFn = [&](Diagnostic &&diag) {
+    producedImportDiagnostic = true;
+    addImportDiagnosticFn(std::move(diag));
+  };
+
   // Perform abstract conversion, ignoring how the type is actually used.
   SwiftTypeConverter converter(
-      *this, addImportDiagnosticFn, allowNSUIntegerAsInt, bridging,
+      *this, trackingDiagnosticFn, allowNSUIntegerAsInt, bridging,
       completionHandlerType, completionHandlerErrorParamIndex);
   auto importResult = converter.Visit(type);
 
   // Now fix up the type based on how we're concretely using it.
   auto adjustedType = adjustTypeForConcreteImport(
       *this, importResult, importKind, allowNSUIntegerAsInt, bridging,
-      addImportDiagnosticFn, attrs, optionality, resugarNSErrorPointer,
+      trackingDiagnosticFn, attrs, optionality, resugarNSErrorPointer,
       objCLifetime);
 
+  if (cacheKey && !producedImportDiagnostic)
+    ImportedTypesCache.insert({*cacheKey, adjustedType});
+
   return adjustedType;
 }
 
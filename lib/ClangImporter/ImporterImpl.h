@@ -600,6 +600,17 @@ public:
   // Mapping from imported types to their raw value types.
   llvm::DenseMap<const NominalTypeDecl *, Type> RawTypes;
 
+  /// Cache of imported types. The key is the Clang type together with the
+  /// import options that affect the result (import kind, attributes,
+  /// bridgeability, optionality, NSUInteger and NSError handling), packed
+  /// into an integer. Only imports that produced no diagnostics are cached,
+  /// so that per-use-site import diagnostics are not dropped.
+  llvm::DenseMap<std::pair<const void *, uint64_t>, ImportedType>
+      ImportedTypesCache;
+
+  /// Memoized results of \c isUnavailableInSwift.
+  llvm::DenseMap<const clang::Decl *, bool> UnavailableInSwiftDecls;
+
   // Caches used by ObjCInterfaceAndImplementationRequest.
   llvm::DenseMap<Decl *, Decl *> ImplementationsByInterface;
   llvm::DenseMap<Decl *, llvm::TinyPtrVector<Decl*>> InterfacesByImplementation;
@@ -1184,9 +1195,19 @@ public:
 
   /// Determine whether the given declaration is considered
   /// 'unavailable' in Swift.
+  ///
+  /// The verdict is memoized: computing it scans the declaration's
+  /// availability attributes with per-platform string comparisons, and the
+  /// same declarations are queried repeatedly while importing names, decls,
+  /// and conformances.
   bool isUnavailableInSwift(const clang::Decl *decl) {
-    return importer::isUnavailableInSwift(
+    auto known = UnavailableInSwiftDecls.find(decl);
+    if (known != UnavailableInSwiftDecls.end())
+      return known->second;
+    bool result = importer::isUnavailableInSwift(
         decl, &platformAvailability, SwiftContext.LangOpts.EnableObjCInterop);
+    UnavailableInSwiftDecls.insert({decl, result});
+    return result;
   }
 
   /// Add "Unavailable" annotation to the swift declaration.
@@ -294,6 +294,15 @@ const uint16_t SWIFT_LOOKUP_TABLE_VERSION_MINOR = 18; // Unsafe C++ method renam
 /// entities. This lookup table provides efficient access to the C
 /// entities based on their Swift names, and is used by the Clang
 /// importer to satisfy the Swift compiler's queries.
+///
+/// Tables loaded from a PCM are never materialized wholesale: the serialized
+/// form is an on-disk hash table (\c llvm::OnDiskIterableChainedHashTable)
+/// whose backing bytes live in the module file's mmap'd buffer, and
+/// \c findOrCreate consults it in place one base name at a time, memoizing
+/// each result in \c LookupTable. Per-job deserialization cost is therefore
+/// proportional to the names a job actually looks up, not to the size of the
+/// import surface. Only \c deserializeAll (debug dumping) and the
+/// visible-decl enumerations that call \c allBaseNames walk the whole table.
 class SwiftLookupTable {
 public:
   /// The kind of context in which a name occurs.
@@ -76,9 +76,25 @@ public:
     // Visit peers expanded from macros
     D->visitAuxiliaryDecls([&](Decl *decl) { decl->walk(*this); },
                            /*visitFreestandingExpanded=*/false);
+
+    // The types we extract from are either top-level or members of other
+    // type declarations; types local to a function body have no stable
+    // qualified name for consumers of the extracted values. Skipping bodies
+    // keeps the scan proportional to the declaration structure of the module
+    // rather than to the size of every function.
+    if (isa<AbstractFunctionDecl>(D))
+      return Action::SkipNode();
+
     return Action::Continue();
   }
 
+  PreWalkResult<Expr *> walkToExprPre(Expr *E) override {
+    // Expressions cannot contain type declarations of interest; the only
+    // candidates would be types local to a closure body, which are skipped
+    // for the same reason as other local types.
+    return Action::SkipNode(E);
+  }
+
 private:
   std::unordered_set<NominalTypeDecl *> CheckedDecls;
 };
@@ -58,9 +58,14 @@ NodePointer Context::demangleTypeAsNode(llvm::StringRef MangledName) {
 std::string Context::demangleSymbolAsString(llvm::StringRef MangledName,
                                             const DemangleOptions &Options) {
   NodePointer root = demangleSymbolAsNode(MangledName);
-  if (!root) return MangledName.str();
+  std::string demangling = root ? nodeToString(root, Options) : std::string();
+
+  // The returned string is self-contained, so the node tree isn't needed
+  // anymore. Resetting eagerly recycles the demangler's largest slab, which
+  // makes repeated calls on a reused context allocation-free in the steady
+  // state.
+  clear();
 
-  std::string demangling = nodeToString(root, Options);
   if (demangling.empty())
     return MangledName.str();
   return demangling;
@@ -69,9 +74,11 @@ std::string Context::demangleSymbolAsString(llvm::StringRef MangledName,
 std::string Context::demangleTypeAsString(llvm::StringRef MangledName,
                                           const DemangleOptions &Options) {
   NodePointer root = demangleTypeAsNode(MangledName);
-  if (!root) return MangledName.str();
-  
-  std::string demangling = nodeToString(root, Options);
+  std::string demangling = root ? nodeToString(root, Options) : std::string();
+
+  // See demangleSymbolAsString above.
+  clear();
+
   if (demangling.empty())
     return MangledName.str();
   return demangling;
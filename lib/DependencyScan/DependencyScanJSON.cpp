@@ -22,17 +22,20 @@ using namespace swift::c_string_utils;
 using namespace llvm;
 
 namespace {
-std::string quote(StringRef unquoted) {
-  llvm::SmallString<128> buffer;
-  llvm::raw_svector_ostream os(buffer);
-  for (const auto ch : unquoted) {
-    if (ch == '\\')
-      os << '\\';
-    if (ch == '"')
-      os << '\\';
-    os << ch;
+/// Write \p unquoted to \p os with JSON escaping applied. Unescaped runs are
+/// emitted in bulk instead of copying the string character by character into
+/// a temporary; most values (paths, module names) contain no escapes and are
+/// streamed straight through.
+void writeQuoted(llvm::raw_ostream &os, StringRef unquoted) {
+  size_t start = 0;
+  for (size_t i = 0, e = unquoted.size(); i != e; ++i) {
+    const char ch = unquoted[i];
+    if (ch == '\\' || ch == '"') {
+      os << unquoted.slice(start, i) << '\\' << ch;
+      start = i + 1;
+    }
   }
-  return buffer.str().str();
+  os << unquoted.substr(start);
 }
 } // namespace
 
@@ -46,14 +49,16 @@ void writeJSONSingleField(llvm::raw_ostream &out, StringRef fieldName,
 void writeJSONValue(llvm::raw_ostream &out, StringRef value,
                     unsigned indentLevel) {
   out << "\"";
-  out << quote(value);
+  writeQuoted(out, value);
   out << "\"";
 }
 
 void writeJSONValue(llvm::raw_ostream &out, swiftscan_string_ref_t value,
                     unsigned indentLevel) {
   out << "\"";
-  out << quote(get_C_string(value));
+  // The string ref already knows its length; don't re-measure the data.
+  if (const char *data = get_C_string(value))
+    writeQuoted(out, StringRef(data, value.length));
   out << "\"";
 }
 
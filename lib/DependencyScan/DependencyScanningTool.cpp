@@ -242,7 +242,17 @@ bool DependencyScanningTool::loadCache(llvm::StringRef path) {
           path, *ScanningService);
   if (readFailed) {
     Diags.diagnose(SourceLoc(), diag::warn_scanner_deserialize_failed, path);
+    return readFailed;
   }
+
+  // Drop entries whose inputs changed after the cache was written, along with
+  // everything that transitively depends on them; those modules are
+  // re-scanned on the next query while the rest of the prior build's scan
+  // stays warm.
+  llvm::sys::fs::file_status cacheStatus;
+  if (!llvm::sys::fs::status(path, cacheStatus))
+    ScanningService->removeDependenciesModifiedSince(
+        cacheStatus.getLastModificationTime());
   return readFailed;
 }
 
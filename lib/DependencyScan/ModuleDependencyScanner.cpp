@@ -291,14 +291,14 @@ ModuleDependencyScanner::ModuleDependencyScanner(
     const CompilerInvocation &ScanCompilerInvocation,
     const SILOptions &SILOptions, ASTContext &ScanASTContext,
     swift::DependencyTracker &DependencyTracker, DiagnosticEngine &Diagnostics,
-    bool ParallelScan)
+    bool ParallelScan, unsigned ParallelScanThreads)
     : ScanCompilerInvocation(ScanCompilerInvocation),
       ScanASTContext(ScanASTContext), Diagnostics(Diagnostics),
-      NumThreads(ParallelScan
-                     ? llvm::hardware_concurrency().compute_thread_count()
-                     : 1),
+      NumThreads(!ParallelScan ? 1
+                 : ParallelScanThreads
+                     ? ParallelScanThreads
+                     : llvm::hardware_concurrency().compute_thread_count()),
       ScanningThreadPool(llvm::hardware_concurrency(NumThreads)) {
-  // TODO: Make num threads configurable
   for (size_t i = 0; i < NumThreads; ++i)
     Workers.emplace_front(std::make_unique<ModuleDependencyScanningWorker>(
         ScanningService, ScanCompilerInvocation, SILOptions, ScanASTContext,
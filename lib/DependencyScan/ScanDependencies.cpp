@@ -1414,7 +1414,8 @@ swift::dependencies::performModuleScan(CompilerInstance &instance,
       cache.getScanService(), instance.getInvocation(),
       instance.getSILOptions(), instance.getASTContext(),
       *instance.getDependencyTracker(), instance.getDiags(),
-      instance.getInvocation().getFrontendOptions().ParallelDependencyScan);
+      instance.getInvocation().getFrontendOptions().ParallelDependencyScan,
+      instance.getInvocation().getFrontendOptions().ParallelDependencyScanThreads);
 
   // Identify imports of the main module and add an entry for it
   // to the dependency graph.
@@ -1466,7 +1467,8 @@ swift::dependencies::performModulePrescan(CompilerInstance &instance,
       cache.getScanService(), instance.getInvocation(),
       instance.getSILOptions(), instance.getASTContext(),
       *instance.getDependencyTracker(), instance.getDiags(),
-      instance.getInvocation().getFrontendOptions().ParallelDependencyScan);
+      instance.getInvocation().getFrontendOptions().ParallelDependencyScan,
+      instance.getInvocation().getFrontendOptions().ParallelDependencyScanThreads);
   // Execute import prescan, and write JSON output to the output stream
   auto mainDependencies =
       scanner.getMainModuleDependencyInfo(instance.getMainModule());
@@ -1516,7 +1518,10 @@ swift::dependencies::performBatchModuleScan(
             cache.getScanService(), instance.getInvocation(),
             instance.getSILOptions(), instance.getASTContext(),
             *instance.getDependencyTracker(), instance.getDiags(),
-            instance.getInvocation().getFrontendOptions().ParallelDependencyScan);
+            instance.getInvocation().getFrontendOptions().ParallelDependencyScan,
+            instance.getInvocation()
+                .getFrontendOptions()
+                .ParallelDependencyScanThreads);
 
         StringRef moduleName = entry.moduleName;
         bool isClang = !entry.isSwift;
@@ -11,6 +11,8 @@
 //===----------------------------------------------------------------------===//
 
 #include "swift/DependencyScan/StringUtils.h"
+#include <cstdlib>
+#include <cstring>
 #include <string>
 #include <vector>
 
@@ -31,9 +33,15 @@ swiftscan_string_ref_t create_clone(const char *string) {
   if (string[0] == '\0')
     return create_null();
 
+  // Measure the string once; strdup followed by a separate strlen would scan
+  // it twice.
+  size_t length = strlen(string);
+  char *copy = static_cast<char *>(malloc(length + 1));
+  memcpy(copy, string, length + 1);
+
   swiftscan_string_ref_t str;
-  str.data = strdup(string);
-  str.length = strlen(string);
+  str.data = copy;
+  str.length = length;
   return str;
 }
 
@@ -240,6 +240,14 @@ namespace driver {
     /// Only intended for source files.
     llvm::SmallDenseMap<const Job *, bool, 16> UnfinishedCommands;
 
+    /// A map from a Job to the jobs that list it among their inputs, i.e. the
+    /// reverse of the dependency edges walked by \c findUnfinishedJob.
+    llvm::SmallDenseMap<const Job *, TinyPtrVector<const Job *>, 16> Dependents;
+
+    /// Memoized critical-path heights: the length of the longest chain of
+    /// jobs that cannot start until the keyed job has finished.
+    llvm::SmallDenseMap<const Job *, unsigned, 16> DownstreamHeights;
+
   private:
     /// TaskQueue for execution.
     std::unique_ptr<TaskQueue> TQ;
@@ -255,6 +263,33 @@ namespace driver {
     llvm::SmallDenseMap<const Job *, std::unique_ptr<llvm::Timer>, 16>
     DriverTimers;
 
+    /// Record the reverse dependency edges for every job in the compilation,
+    /// for use by \c getDownstreamHeight.
+    void computeDependentsGraph() {
+      for (const Job *Cmd : Comp.getJobs())
+        for (const Job *Input : Cmd->getInputs())
+          Dependents[Input].push_back(Cmd);
+    }
+
+    /// Return the length of the longest chain of jobs blocked (directly or
+    /// transitively) on \p Cmd. Jobs created after \c computeDependentsGraph
+    /// ran (e.g. synthetic BatchJobs) have no recorded dependents and report
+    /// a height of zero.
+    unsigned getDownstreamHeight(const Job *Cmd) {
+      auto Known = DownstreamHeights.find(Cmd);
+      if (Known != DownstreamHeights.end())
+        return Known->second;
+      // The job graph is acyclic, so plain recursion terminates.
+      unsigned Height = 0;
+      auto DepIter = Dependents.find(Cmd);
+      if (DepIter != Dependents.end()) {
+        for (const Job *Dependent : DepIter->second)
+          Height = std::max(Height, getDownstreamHeight(Dependent) + 1);
+      }
+      DownstreamHeights[Cmd] = Height;
+      return Height;
+    }
+
     const Job *findUnfinishedJob(ArrayRef<const Job *> JL) {
       for (const Job *Cmd : JL) {
         if (!FinishedCommands.count(Cmd))
@@ -637,6 +672,7 @@ namespace driver {
 
     /// Schedule and run initial, additional, and batch jobs.
     void runJobs() {
+      computeDependentsGraph();
       scheduleJobsBeforeBatching();
       formBatchJobsAndAddPendingJobsToTaskQueue();
       runTaskQueueToCompletion();
@@ -656,7 +692,18 @@ namespace driver {
     /// TaskQueue, and clear \p Cmds.
     template <typename Container>
     void transferJobsToTaskQueue(Container &Cmds, StringRef Kind) {
-      for (const Job *Cmd : Cmds) {
+      // Enqueue the jobs with the longest chain of blocked downstream work
+      // first. The TaskQueue hands tasks to a fixed pool of parallel workers
+      // in FIFO order, so fronting the critical path keeps it from waiting
+      // behind independent peers and being scheduled last. The sort is
+      // stable: jobs of equal height keep their compilation-input order.
+      llvm::SmallVector<const Job *, 16> SortedCmds(Cmds.begin(), Cmds.end());
+      std::stable_sort(SortedCmds.begin(), SortedCmds.end(),
+                       [this](const Job *LHS, const Job *RHS) {
+                         return getDownstreamHeight(LHS) >
+                                getDownstreamHeight(RHS);
+                       });
+      for (const Job *Cmd : SortedCmds) {
         if (Comp.getShowJobLifecycle())
           llvm::outs() << "Adding " << Kind
                        << " job to task queue: "
@@ -701,35 +748,86 @@ namespace driver {
         Batches.push_back(Comp.addJob(std::move(J)));
     }
 
+    /// Estimate the relative cost of compiling \p Cmd: the size in bytes of
+    /// its primary input. We have no record of per-file compile times from
+    /// previous builds, and source size is a workable stand-in: the batches
+    /// that define the tail latency of a batch-mode build are the ones stuck
+    /// with a handful of very large (often generated) files. Returns at least
+    /// 1 so every job carries some weight.
+    uint64_t estimateJobCost(const Job *Cmd) {
+      uint64_t Size = 0;
+      StringRef Input = Cmd->getFirstSwiftPrimaryInput();
+      if (!Input.empty())
+        (void)llvm::sys::fs::file_size(Input, Size);
+      return std::max<uint64_t>(Size, 1);
+    }
+
     /// Build a vector of partition indices, one per Job: the i'th index says
-    /// which batch of the partition the i'th Job will be assigned to. If we are
+    /// which batch of the partition the i'th Job will be assigned to. Jobs
+    /// are assigned to batches in contiguous runs of roughly equal estimated
+    /// cost, rather than equal count, so a single batch does not end up
+    /// holding several of the most expensive files just because they happen
+    /// to be adjacent on the command line. If we are
     /// shuffling due to -driver-batch-seed, the returned indices will not be
     /// arranged in contiguous runs. We shuffle partition-indices here, not
     /// elements themselves, to preserve the invariant that each batch is a
     /// subsequence of the full set of inputs, not just a subset.
     std::vector<size_t>
     assignJobsToPartitions(size_t PartitionSize,
-                           size_t NumJobs) {
-      size_t Remainder = NumJobs % PartitionSize;
-      size_t TargetSize = NumJobs / PartitionSize;
+                           ArrayRef<const Job *> Jobs) {
+      size_t NumJobs = Jobs.size();
       std::vector<size_t> PartitionIndex;
       PartitionIndex.reserve(NumJobs);
-      for (size_t P = 0; P < PartitionSize; ++P) {
-        // Spread remainder evenly across partitions by adding 1 to the target
-        // size of the first Remainder of them.
-        size_t FillCount = TargetSize + ((P < Remainder) ? 1 : 0);
-        std::fill_n(std::back_inserter(PartitionIndex), FillCount, P);
-      }
+
       if (Comp.getBatchSeed() != 0) {
+        // Shuffling exists to randomize batch composition for debugging, so
+        // there is no point balancing costs first: spread jobs by count and
+        // shuffle, as before.
+        size_t Remainder = NumJobs % PartitionSize;
+        size_t TargetSize = NumJobs / PartitionSize;
+        for (size_t P = 0; P < PartitionSize; ++P) {
+          // Spread remainder evenly across partitions by adding 1 to the
+          // target size of the first Remainder of them.
+          size_t FillCount = TargetSize + ((P < Remainder) ? 1 : 0);
+          std::fill_n(std::back_inserter(PartitionIndex), FillCount, P);
+        }
         std::minstd_rand gen(Comp.getBatchSeed());
         std::shuffle(PartitionIndex.begin(), PartitionIndex.end(), gen);
+        assert(PartitionIndex.size() == NumJobs);
+        return PartitionIndex;
+      }
+
+      uint64_t TotalCost = 0;
+      std::vector<uint64_t> Costs;
+      Costs.reserve(NumJobs);
+      for (const Job *Cmd : Jobs) {
+        Costs.push_back(estimateJobCost(Cmd));
+        TotalCost += Costs.back();
+      }
+
+      // Advance to the next batch each time the cumulative cost crosses the
+      // current batch's share of the total, spreading the remainder over the
+      // first few batches. When every job has the same cost this degenerates
+      // to the even count-based split.
+      uint64_t TargetCost = TotalCost / PartitionSize;
+      uint64_t Remainder = TotalCost % PartitionSize;
+      uint64_t CumulativeCost = 0;
+      size_t P = 0;
+      for (uint64_t Cost : Costs) {
+        PartitionIndex.push_back(P);
+        CumulativeCost += Cost;
+        uint64_t Boundary =
+            (P + 1) * TargetCost + std::min<uint64_t>(P + 1, Remainder);
+        if (CumulativeCost >= Boundary && P + 1 < PartitionSize)
+          ++P;
       }
       assert(PartitionIndex.size() == NumJobs);
       return PartitionIndex;
     }
 
     /// Create \c NumberOfParallelCommands batches and assign each job to a
-    /// batch either filling each partition in order or, if seeded with a
+    /// batch either filling each partition in order with roughly equal
+    /// estimated cost or, if seeded with a
     /// nonzero value, pseudo-randomly (but deterministically and nearly-evenly).
     void partitionIntoBatches(std::vector<const Job *> Batchable,
                               BatchPartition &Partition) {
@@ -740,7 +838,7 @@ namespace driver {
 
       assert(!Partition.empty());
       auto PartitionIndex = assignJobsToPartitions(Partition.size(),
-                                                   Batchable.size());
+                                                   Batchable);
       assert(PartitionIndex.size() == Batchable.size());
       auto const &TC = Comp.getToolChain();
       for_each(Batchable, PartitionIndex, [&](const Job *Cmd, size_t Idx) {
@@ -143,6 +143,15 @@ bool ArgsToFrontendOptionsConverter::convert(
   Opts.ReuseDependencyScannerCache |= Args.hasArg(OPT_reuse_dependency_scan_cache);
   Opts.EmitDependencyScannerCacheRemarks |= Args.hasArg(OPT_dependency_scan_cache_remarks);
   Opts.ParallelDependencyScan |= Args.hasArg(OPT_parallel_scan);
+  if (const Arg *A = Args.getLastArg(OPT_parallel_scan_threads)) {
+    unsigned threadCount;
+    if (StringRef(A->getValue()).getAsInteger(10, threadCount)) {
+      Diags.diagnose(SourceLoc(), diag::error_invalid_arg_value,
+                     A->getAsString(Args), A->getValue());
+      return true;
+    }
+    Opts.ParallelDependencyScanThreads = threadCount;
+  }
   if (const Arg *A = Args.getLastArg(OPT_dependency_scan_cache_path)) {
     Opts.SerializedDependencyScannerCachePath = A->getValue();
   }
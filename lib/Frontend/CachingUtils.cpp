@@ -139,7 +139,9 @@ bool replayCachedCompilerOutputs(
   struct OutputEntry {
     std::string Path;
     CASID Key;
-    ObjectProxy Proxy;
+    // Loading the object is deferred until all lookups succeed, so a partial
+    // cache hit never pays for materializing outputs it cannot replay.
+    ObjectRef Object;
   };
   SmallVector<OutputEntry> OutputProxies;
   std::optional<OutputEntry> DiagnosticsOutput;
@@ -184,16 +186,12 @@ bool replayCachedCompilerOutputs(
             return createStringError(
                 inconvertibleErrorCode(),
                 "unexpected output kind in the cached output");
-          auto Proxy = CAS.getProxy(Ref);
-          if (!Proxy)
-            return Proxy.takeError();
-
           if (Kind == file_types::ID::TY_CachedDiagnostics) {
             assert(!DiagnosticsOutput && "more than 1 diagnotics found");
-            DiagnosticsOutput = OutputEntry{OutputPath->second, OutID, *Proxy};
+            DiagnosticsOutput = OutputEntry{OutputPath->second, OutID, Ref};
           } else
             OutputProxies.emplace_back(
-                OutputEntry{OutputPath->second, OutID, *Proxy});
+                OutputEntry{OutputPath->second, OutID, Ref});
           return Error::success();
         })) {
       Diag.diagnose(SourceLoc(), diag::error_cas, toString(std::move(Err)));
@@ -260,8 +258,13 @@ bool replayCachedCompilerOutputs(
 
   // Replay Diagnostics first so the output failures comes after.
   // Also if the diagnostics replay failed, proceed to re-compile.
-  if (auto E = CDP.replayCachedDiagnostics(
-          DiagnosticsOutput->Proxy.getData())) {
+  auto DiagProxy = CAS.getProxy(DiagnosticsOutput->Object);
+  if (!DiagProxy) {
+    Diag.diagnose(SourceLoc(), diag::error_cas,
+                  toString(DiagProxy.takeError()));
+    return false;
+  }
+  if (auto E = CDP.replayCachedDiagnostics(DiagProxy->getData())) {
     Diag.diagnose(SourceLoc(), diag::error_replay_cached_diag,
                   toString(std::move(E)));
     return false;
@@ -275,13 +278,18 @@ bool replayCachedCompilerOutputs(
   // Use on disk output backend directly here to write to disk.
   llvm::vfs::OnDiskOutputBackend Backend;
   for (auto &Output : OutputProxies) {
+    auto Proxy = CAS.getProxy(Output.Object);
+    if (!Proxy) {
+      Diag.diagnose(SourceLoc(), diag::error_cas, toString(Proxy.takeError()));
+      continue;
+    }
     auto File = Backend.createFile(Output.Path);
     if (!File) {
       Diag.diagnose(SourceLoc(), diag::error_opening_output, Output.Path,
                     toString(File.takeError()));
       continue;
     }
-    *File << Output.Proxy.getData();
+    *File << Proxy->getData();
     if (auto E = File->keep()) {
       Diag.diagnose(SourceLoc(), diag::error_closing_output, Output.Path,
                     toString(std::move(E)));
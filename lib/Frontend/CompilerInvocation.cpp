@@ -2627,6 +2627,12 @@ static bool ParseSILArgs(SILOptions &Opts, ArgList &Args,
   if (const Arg *A = Args.getLastArg(OPT_save_optimization_record_path))
     Opts.OptRecordFile = A->getValue();
 
+  if (const Arg *A = Args.getLastArg(OPT_emit_symbol_order_path))
+    Opts.SymbolOrderFile = A->getValue();
+
+  if (const Arg *A = Args.getLastArg(OPT_linker_used_symbols_file))
+    Opts.LinkerUsedSymbolsFile = A->getValue();
+
   // If any of the '-g<kind>', except '-gnone', is given,
   // tell the SILPrinter to print debug info as well
   if (const Arg *A = Args.getLastArg(OPT_g_Group)) {
@@ -31,6 +31,7 @@
 #include "llvm/Support/Debug.h"
 #include "llvm/Support/CommandLine.h"
 #include "llvm/Support/CrashRecoveryContext.h"
+#include "llvm/Support/FileSystem.h"
 #include "llvm/Support/Path.h"
 #include "llvm/Support/Errc.h"
 #include "llvm/Support/Regex.h"
@@ -375,6 +376,12 @@ bool ImplicitModuleInterfaceBuilder::buildSwiftModule(StringRef OutPath,
   if (disableInterfaceFileLock) {
     return build();
   }
+  // Snapshot the output's state before taking the lock. The decision that a
+  // rebuild is needed was made before this point, so if the output changes
+  // while we contend for the lock, a concurrent invocation has rebuilt it and
+  // we can use its result instead of building the same module again.
+  llvm::sys::fs::file_status initialOutStatus;
+  bool hasInitialOutStatus = !llvm::sys::fs::status(OutPath, initialOutStatus);
   while (1) {
   // Attempt to lock the interface file. Only one process is allowed to build
   // module from the interface so we don't consume too much memory when multiple
@@ -395,6 +402,24 @@ bool ImplicitModuleInterfaceBuilder::buildSwiftModule(StringRef OutPath,
     LLVM_FALLTHROUGH;
   }
   case llvm::LockFileManager::LFS_Owned: {
+    // Another invocation may have finished building this module between our
+    // decision to rebuild and our acquisition of the lock, e.g. after we timed
+    // out waiting or the previous owner died right after committing its
+    // output. If the output changed since we decided to rebuild, load it
+    // instead of building it a second time; it will be verified on load like
+    // any other candidate.
+    llvm::sys::fs::file_status currentOutStatus;
+    if (!llvm::sys::fs::status(OutPath, currentOutStatus) &&
+        (!hasInitialOutStatus ||
+         initialOutStatus.getLastModificationTime() !=
+             currentOutStatus.getLastModificationTime())) {
+      auto bufferOrError = llvm::MemoryBuffer::getFile(OutPath);
+      if (bufferOrError) {
+        if (ModuleBuffer)
+          *ModuleBuffer = std::move(bufferOrError.get());
+        return false;
+      }
+    }
     return build();
   }
   case llvm::LockFileManager::LFS_Shared: {
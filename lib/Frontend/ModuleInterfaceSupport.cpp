@@ -862,6 +862,11 @@ bool swift::emitSwiftInterface(raw_ostream &out,
 
   SmallVector<Decl *, 16> topLevelDecls;
   M->getTopLevelDeclsWithAuxiliaryDecls(topLevelDecls);
+  // Decls are printed serially even though the output is independent per
+  // decl: printing is what forces interface types, availability, and
+  // conformances through the request evaluator, and those requests mutate
+  // the ASTContext. Any attempt to fan decls out across threads has to
+  // make the evaluator concurrency-safe first.
   for (const Decl *D : topLevelDecls) {
     InheritedProtocolCollector::collectProtocols(inheritedProtocolMap, D);
 
@@ -20,6 +20,8 @@
 #include "llvm/Support/SmallVectorMemoryBuffer.h"
 #include "llvm/Support/VirtualOutputBackend.h"
 
+#include <thread>
+
 using namespace swift;
 
 static ModuleDecl *getModule(ModuleOrSourceFile DC) {
@@ -72,14 +74,15 @@ void swift::serializeToBuffers(
   {
     FrontendStatsTracer tracer(getContext(DC).Stats,
                                "Serialization, swiftmodule, to buffer");
-    llvm::SmallString<1024> buf;
-    llvm::raw_svector_ostream stream(buf);
-    serialization::writeToStream(stream, DC, M, options,
-                                 /*dependency info*/ nullptr);
+    // Take the serializer's buffer directly rather than copying it into a
+    // second one; for large merged modules the image itself dominates the
+    // peak memory of this job.
+    llvm::SmallVector<char, 0> buf = serialization::writeToBuffer(
+        DC, M, options, /*dependency info*/ nullptr);
     bool hadError = withOutputPath(
         getContext(DC).Diags, getContext(DC).getOutputBackend(),
         options.OutputPath, [&](raw_ostream &out) {
-          out << stream.str();
+          out.write(buf.data(), buf.size());
           return false;
         });
     if (hadError)
@@ -143,16 +146,31 @@ void swift::serialize(
     return;
   }
 
-  bool hadError = withOutputPath(
-      getContext(DC).Diags, getContext(DC).getOutputBackend(),
-      options.OutputPath, [&](raw_ostream &out) {
-        FrontendStatsTracer tracer(getContext(DC).Stats,
-                                   "Serialization, swiftmodule");
-        serialization::writeToStream(out, DC, M, options, DG);
-        return false;
-      });
-  if (hadError)
+  llvm::SmallVector<char, 0> moduleBuf;
+  {
+    FrontendStatsTracer tracer(getContext(DC).Stats,
+                               "Serialization, swiftmodule");
+    moduleBuf = serialization::writeToBuffer(DC, M, options, DG);
+  }
+
+  llvm::vfs::OutputConfig config;
+  config.setAtomicWrite().setOnlyIfDifferent();
+  auto moduleFile =
+      getContext(DC).getOutputBackend().createFile(options.OutputPath, config);
+  if (!moduleFile) {
+    getContext(DC).Diags.diagnose(SourceLoc(), diag::error_opening_output,
+                                  options.OutputPath,
+                                  toString(moduleFile.takeError()));
     return;
+  }
+
+  // Stream the swiftmodule out on a background thread while the swiftdoc and
+  // swiftsourceinfo serializations run below. The serializations themselves
+  // must stay on this thread: their AST walks trigger lazy member loading,
+  // which mutates the ASTContext. The writer thread only touches its own
+  // stream; keep() and any diagnostics happen back here after the join.
+  std::thread moduleWriter(
+      [&] { moduleFile->write(moduleBuf.data(), moduleBuf.size()); });
 
   if (!options.DocOutputPath.empty()) {
     (void)withOutputPath(
@@ -176,6 +194,14 @@ void swift::serialize(
         });
   }
 
+  moduleWriter.join();
+  if (auto error = moduleFile->keep()) {
+    getContext(DC).Diags.diagnose(SourceLoc(), diag::error_closing_output,
+                                  options.OutputPath,
+                                  toString(std::move(error)));
+    return;
+  }
+
   if (!symbolGraphOptions.OutputDir.empty()) {
     if (DC.is<ModuleDecl *>()) {
       auto *M = DC.get<ModuleDecl *>();
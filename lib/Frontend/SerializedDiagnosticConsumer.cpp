@@ -24,6 +24,7 @@
 #include "swift/Frontend/PrintingDiagnosticConsumer.h"
 #include "swift/Parse/Lexer.h"
 #include "llvm/ADT/StringRef.h"
+#include "llvm/ADT/StringSet.h"
 #include "llvm/ADT/Twine.h"
 #include "llvm/ADT/DenseMap.h"
 #include "llvm/Support/FileSystem.h"
@@ -90,6 +91,10 @@ struct SharedState : llvm::RefCountedBase<SharedState> {
   /// The collection of flags used.
   llvm::StringMap<unsigned> Flags;
 
+  /// Keys of the notes already emitted in the current DIAG block, used to
+  /// coalesce notes that exactly repeat an earlier one.
+  llvm::StringSet<> NotesInCurrentBlock;
+
   /// Whether we have already started emission of any DIAG blocks. Once
   /// this becomes \c true, we never close a DIAG block until we know that we're
   /// starting another one or we're done.
@@ -660,9 +665,6 @@ void SerializedDiagnosticConsumer::handleDiagnostic(
   // Make sure we bracket all notes as "sub-diagnostics".
   bool bracketDiagnostic = (Info.Kind == DiagnosticKind::Note);
 
-  if (bracketDiagnostic)
-    enterDiagBlock();
-
   // Actually substitute the diagnostic arguments into the diagnostic text.
   llvm::SmallString<256> Text;
   {
@@ -671,6 +673,35 @@ void SerializedDiagnosticConsumer::handleDiagnostic(
                                            Info.FormatArgs);
   }
 
+  if (bracketDiagnostic) {
+    // Coalesce notes that exactly repeat one already attached to the current
+    // diagnostic; the repeats carry no extra information for .dia readers but
+    // can dominate the output size in batch builds.
+    llvm::SmallString<256> key;
+    {
+      llvm::raw_svector_ostream keyOut(key);
+      keyOut << reinterpret_cast<uintptr_t>(Info.Loc.getOpaquePointerValue())
+             << '\0' << Text << '\0' << Info.Category;
+      for (const auto &R : Info.Ranges)
+        keyOut << '\0'
+               << reinterpret_cast<uintptr_t>(
+                      R.getStart().getOpaquePointerValue())
+               << ':' << R.getByteLength();
+      for (const auto &F : Info.FixIts)
+        keyOut << '\0'
+               << reinterpret_cast<uintptr_t>(
+                      F.getRange().getStart().getOpaquePointerValue())
+               << ':' << F.getText();
+    }
+    if (!State->NotesInCurrentBlock.insert(key).second)
+      return;
+  } else {
+    State->NotesInCurrentBlock.clear();
+  }
+
+  if (bracketDiagnostic)
+    enterDiagBlock();
+
   emitDiagnosticMessage(SM, Info.Loc, Info.Kind, Text, Info);
 
   if (bracketDiagnostic)
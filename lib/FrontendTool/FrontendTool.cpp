@@ -85,6 +85,7 @@
 #include "llvm/Option/OptTable.h"
 #include "llvm/Support/Error.h"
 #include "llvm/Support/ErrorHandling.h"
+#include "llvm/Support/Parallel.h"
 #include "llvm/Support/Path.h"
 #include "llvm/Support/VirtualOutputBackend.h"
 #include "llvm/Support/VirtualOutputBackends.h"
@@ -1945,6 +1946,8 @@ static void emitIndexDataForSourceFile(SourceFile *PrimarySourceFile,
   if (opts.IndexStorePath.empty())
     return;
 
+  FrontendStatsTracer tracer(Instance.getStatsReporter(), "emit-index-data");
+
   // FIXME: provide index unit token(s) explicitly and only use output file
   // paths as a fallback.
 
@@ -2243,6 +2246,15 @@ int swift::performFrontend(ArrayRef<const char *> Args,
     llvm::setBugReportMsg(nullptr);
   }
   
+  // Size LLVM's shared parallel executor to match -num-threads, so that code
+  // using llvm::parallelFor and friends shares one pool with the LLVM codegen
+  // threads instead of each sizing itself to the whole machine. A frontend
+  // process only parses one invocation, so configuring the process-wide
+  // strategy here is safe; libraries hosting multiple invocations (e.g.
+  // SourceKit) never reach this code.
+  if (unsigned numThreads = Invocation.getIRGenOptions().NumThreads)
+    llvm::parallel::strategy = llvm::hardware_concurrency(numThreads);
+
   PrettyStackTraceFrontend frontendTrace(Invocation);
 
   // Make an array of PrettyStackTrace objects to dump the configuration files
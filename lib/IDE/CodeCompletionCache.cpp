@@ -104,7 +104,7 @@ CodeCompletionCache::~CodeCompletionCache() {}
 /// This should be incremented any time we commit a change to the format of the
 /// cached results. This isn't expected to change very often.
 static constexpr uint32_t onDiskCompletionCacheVersion =
-    12; // Removed 'IsAsync'.
+    13; // Null-terminate strings so they can be referenced in place.
 
 /// Deserializes CodeCompletionResults from \p in and stores them in \p V.
 /// \see writeCacheModule.
@@ -159,20 +159,16 @@ static bool readCachedModule(llvm::MemoryBuffer *in,
   (void)typesSize; // so it is not seen as "unused" in release builds.
 
   // STRINGS
-  llvm::DenseMap<uint32_t, NullTerminatedStringRef> knownStrings;
+  // Strings are stored null-terminated in the file, so they can be
+  // referenced directly in the (memory-mapped) buffer without copying them
+  // into the value's allocator. V.SerializedBuffer keeps the buffer alive
+  // for as long as the results are.
   auto getString = [&](uint32_t index) -> NullTerminatedStringRef {
     if (index == ~0u)
       return "";
-    auto found = knownStrings.find(index);
-    if (found != knownStrings.end()) {
-      return found->second;
-    }
-
     const char *p = strings + index;
     size_t size = read32le(p);
-    auto str = NullTerminatedStringRef(StringRef(p, size), *V.Allocator);
-    knownStrings[index] = str;
-    return str;
+    return NullTerminatedStringRef(p, size);
   };
 
   // TYPES
@@ -358,6 +354,8 @@ static void writeCachedModule(llvm::raw_ostream &out,
     endian::Writer LE(strings, little);
     LE.write(static_cast<uint32_t>(str.size()));
     strings << str;
+    // Null-terminate so readers can reference the string in place.
+    strings << '\0';
     knownStrings[str] = size;
     return static_cast<uint32_t>(size);
   };
@@ -506,8 +504,13 @@ static std::string getName(StringRef cacheDirectory,
 
 std::optional<CodeCompletionCache::ValueRefCntPtr>
 OnDiskCodeCompletionCache::get(const Key &K) {
-  // Try to find the cached file.
-  auto bufferOrErr = llvm::MemoryBuffer::getFile(getName(cacheDirectory, K));
+  // Try to find the cached file. Prefer a memory-mapped buffer: the results
+  // reference the string data in place, so mapping the file shares those
+  // pages between sessions reading the same cache.
+  auto bufferOrErr =
+      llvm::MemoryBuffer::getFile(getName(cacheDirectory, K),
+                                  /*IsText=*/false,
+                                  /*RequiresNullTerminator=*/false);
   if (!bufferOrErr)
     return std::nullopt;
 
@@ -515,6 +518,7 @@ OnDiskCodeCompletionCache::get(const Key &K) {
   auto V = CodeCompletionCache::createValue();
   if (!readCachedModule(bufferOrErr.get().get(), K, *V))
     return std::nullopt;
+  V->SerializedBuffer = std::move(bufferOrErr.get());
 
   return V;
 }
@@ -549,7 +553,8 @@ std::error_code OnDiskCodeCompletionCache::set(const Key &K, ValueRefCntPtr V) {
 std::optional<CodeCompletionCache::ValueRefCntPtr>
 OnDiskCodeCompletionCache::getFromFile(StringRef filename) {
   // Try to find the cached file.
-  auto bufferOrErr = llvm::MemoryBuffer::getFile(filename);
+  auto bufferOrErr = llvm::MemoryBuffer::getFile(
+      filename, /*IsText=*/false, /*RequiresNullTerminator=*/false);
   if (!bufferOrErr)
     return std::nullopt;
 
@@ -570,6 +575,7 @@ OnDiskCodeCompletionCache::getFromFile(StringRef filename) {
   if (!readCachedModule(bufferOrErr.get().get(), K, *V,
                         /*allowOutOfDate*/ true))
     return std::nullopt;
+  V->SerializedBuffer = std::move(bufferOrErr.get());
 
   return V;
 }
@@ -17,6 +17,7 @@
 #include "swift/AST/USRGeneration.h"
 #include "swift/AST/RawComment.h"
 #include "swift/Basic/SourceManager.h"
+#include "swift/IDE/IDERequests.h"
 #include "swift/Markup/Markup.h"
 #include "swift/Markup/XMLUtils.h"
 #include "swift/Parse/Token.h"
@@ -469,8 +470,8 @@ std::string ide::extractPlainTextFromComment(const StringRef Text) {
   return getLineListFromComment(SourceMgr, MC, Text).str();
 }
 
-bool ide::getDocumentationCommentAsXML(const Decl *D, raw_ostream &OS,
-                                       TypeOrExtensionDecl SynthesizedTarget) {
+static bool getDocumentationCommentAsXMLImpl(
+    const Decl *D, raw_ostream &OS, TypeOrExtensionDecl SynthesizedTarget) {
   auto MaybeClangNode = D->getClangNode();
   if (MaybeClangNode) {
     if (auto *CD = MaybeClangNode.getAsDecl()) {
@@ -497,6 +498,31 @@ bool ide::getDocumentationCommentAsXML(const Decl *D, raw_ostream &OS,
   return true;
 }
 
+std::optional<StringRef>
+DocCommentAsXMLRequest::evaluate(Evaluator &evaluator, const Decl *D) const {
+  SmallString<1024> Buffer;
+  llvm::raw_svector_ostream OS(Buffer);
+  if (!getDocumentationCommentAsXMLImpl(D, OS, TypeOrExtensionDecl()))
+    return std::nullopt;
+  return D->getASTContext().AllocateCopy(Buffer.str());
+}
+
+bool ide::getDocumentationCommentAsXML(const Decl *D, raw_ostream &OS,
+                                       TypeOrExtensionDecl SynthesizedTarget) {
+  // The common case - no synthesized target - is requested repeatedly for the
+  // same decl as the user moves the cursor around, so answer it through the
+  // evaluator, which caches the converted XML for the lifetime of the AST.
+  if (!SynthesizedTarget) {
+    auto Result = evaluateOrDefault(D->getASTContext().evaluator,
+                                    DocCommentAsXMLRequest{D}, std::nullopt);
+    if (!Result)
+      return false;
+    OS << *Result;
+    return true;
+  }
+  return getDocumentationCommentAsXMLImpl(D, OS, SynthesizedTarget);
+}
+
 bool ide::getRawDocumentationComment(const Decl *D, raw_ostream &OS) {
   ClangNode MaybeClangNode = D->getClangNode();
   if (MaybeClangNode) {
@@ -226,6 +226,15 @@ private:
   }
 
   PreWalkResult<Expr *> walkToExprPre(Expr *E) override {
+    // Skip subtrees that cannot contain the location. Any shorthand shadow
+    // that's visible at the location is introduced by an ancestor, so none of
+    // the bookkeeping below is needed for pruned subtrees either. Implicit
+    // expressions may have invalid ranges; walk into those to be safe.
+    if (E->getSourceRange().isValid() &&
+        !rangeContainsLocToResolve(E->getSourceRange())) {
+      return Action::SkipNode(E);
+    }
+
     if (auto closure = dyn_cast<ClosureExpr>(E)) {
       DeclContextStack.push_back(closure);
     }
@@ -259,6 +268,12 @@ private:
   }
 
   PreWalkResult<Stmt *> walkToStmtPre(Stmt *S) override {
+    // As above, prune statements that cannot contain the location.
+    if (S->getSourceRange().isValid() &&
+        !rangeContainsLocToResolve(S->getSourceRange())) {
+      return Action::SkipNode(S);
+    }
+
     if (auto CondStmt = dyn_cast<LabeledConditionalStmt>(S)) {
       for (auto ShorthandShadow :
            getShorthandShadows(CondStmt, getCurrentDeclContext())) {
@@ -36,6 +36,7 @@
 #include "swift/SymbolGraphGen/SymbolGraphOptions.h"
 #include "clang/AST/ASTContext.h"
 #include "llvm/ADT/Hashing.h"
+#include "llvm/ADT/STLExtras.h"
 #include "llvm/Support/MemoryBuffer.h"
 
 using namespace swift;
@@ -187,17 +188,40 @@ bool IDEInspectionInstance::performCachedOperationIfPossible(
   llvm::PrettyStackTraceString trace(
       "While performing cached IDE inspection if possible");
 
-  // Check the invalidation first. Otherwise, in case no 'CacheCI' exists yet,
-  // the flag will remain 'true' even after 'CachedCI' is populated.
-  if (CachedCIShouldBeInvalidated.exchange(false))
+  // Check the invalidation first. Otherwise, in case no cached instance
+  // exists yet, the flag would remain 'true' even after the pool is
+  // populated.
+  if (CachedCIShouldBeInvalidated.exchange(false)) {
+    CachedInstances.clear();
     return false;
-  if (!CachedCI)
-    return false;
-  if (CachedReuseCount >= Opts.MaxASTReuseCount)
-    return false;
-  if (CachedArgHash != ArgsHash)
+  }
+
+  // Find a cached instance for the same invocation and inspected file.
+  auto bufferName = ideInspectionTargetBuffer->getBufferIdentifier();
+  CachedCompilerInstance *Cached = nullptr;
+  for (auto it = CachedInstances.rbegin(); it != CachedInstances.rend();
+       ++it) {
+    auto &entry = **it;
+    if (entry.ArgHash != ArgsHash)
+      continue;
+    if (entry.ReuseCount >= Opts.MaxASTReuseCount)
+      continue;
+    auto *entrySF = entry.CI->getIDEInspectionFile();
+    assert(entrySF->getBufferID());
+    if (entry.CI->getSourceMgr().getIdentifierForBuffer(
+            *entrySF->getBufferID()) != bufferName)
+      continue;
+
+    // Move the entry to the most-recently-used position.
+    std::rotate(it.base() - 1, it.base(), CachedInstances.end());
+    Cached = CachedInstances.back().get();
+    break;
+  }
+  if (!Cached)
     return false;
 
+  std::shared_ptr<CompilerInstance> CachedCI = Cached->CI;
+
   auto *oldSF = CachedCI->getIDEInspectionFile();
   assert(oldSF->getBufferID());
 
@@ -206,11 +230,8 @@ bool IDEInspectionInstance::performCachedOperationIfPossible(
   auto &oldInfo = oldState->getIDEInspectionDelayedDeclState();
 
   auto &SM = CachedCI->getSourceMgr();
-  auto bufferName = ideInspectionTargetBuffer->getBufferIdentifier();
-  if (SM.getIdentifierForBuffer(*oldSF->getBufferID()) != bufferName)
-    return false;
 
-  if (shouldCheckDependencies()) {
+  if (shouldCheckDependencies(*Cached)) {
     // The passed in FileSystem does not have any overlays resolved. Make sure
     // to do so before checking dependencies (otherwise we might decide we need
     // to run the slow path due to a missing/different file).
@@ -223,9 +244,10 @@ bool IDEInspectionInstance::performCachedOperationIfPossible(
 
     if (areAnyDependentFilesInvalidated(
             *CachedCI, *FileSystem, *oldSF->getBufferID(),
-            DependencyCheckedTimestamp, InMemoryDependencyHash))
+            Cached->DependencyCheckedTimestamp,
+            Cached->InMemoryDependencyHash))
       return false;
-    DependencyCheckedTimestamp = std::chrono::system_clock::now();
+    Cached->DependencyCheckedTimestamp = std::chrono::system_clock::now();
   }
 
   // Parse the new buffer into temporary SourceFile.
@@ -439,7 +461,7 @@ bool IDEInspectionInstance::performCachedOperationIfPossible(
       CachedCI->removeDiagnosticConsumer(DiagC);
   }
 
-  CachedReuseCount += 1;
+  Cached->ReuseCount += 1;
 
   return true;
 }
@@ -522,23 +544,43 @@ void IDEInspectionInstance::performNewOperation(
 
 void IDEInspectionInstance::cacheCompilerInstance(
     std::shared_ptr<CompilerInstance> CI, llvm::hash_code ArgsHash) {
-  CachedCI = std::move(CI);
-  CachedArgHash = ArgsHash;
-  auto now = std::chrono::system_clock::now();
-  DependencyCheckedTimestamp = now;
-  CachedReuseCount = 0;
-  InMemoryDependencyHash.clear();
+  auto entry = std::make_unique<CachedCompilerInstance>();
+  entry->CI = std::move(CI);
+  entry->ArgHash = ArgsHash;
+  entry->DependencyCheckedTimestamp = std::chrono::system_clock::now();
   cacheDependencyHashIfNeeded(
-      *CachedCI,
-      CachedCI->getASTContext().SourceMgr.getIDEInspectionTargetBufferID(),
-      InMemoryDependencyHash);
+      *entry->CI,
+      entry->CI->getASTContext().SourceMgr.getIDEInspectionTargetBufferID(),
+      entry->InMemoryDependencyHash);
+
+  // Drop any existing entry for the same invocation and inspected file; the
+  // new instance supersedes it.
+  auto &newSM = entry->CI->getSourceMgr();
+  auto bufferName =
+      newSM.getIdentifierForBuffer(newSM.getIDEInspectionTargetBufferID());
+  llvm::erase_if(CachedInstances,
+                 [&](const std::unique_ptr<CachedCompilerInstance> &existing) {
+    if (existing->ArgHash != ArgsHash)
+      return false;
+    auto &SM = existing->CI->getSourceMgr();
+    return SM.getIdentifierForBuffer(SM.getIDEInspectionTargetBufferID()) ==
+           bufferName;
+  });
+
+  // Evict the least recently used entries to make room.
+  while (CachedInstances.size() >= std::max(Opts.MaxCachedCompilerInstances,
+                                            1u))
+    CachedInstances.erase(CachedInstances.begin());
+
+  CachedInstances.push_back(std::move(entry));
 }
 
-bool IDEInspectionInstance::shouldCheckDependencies() const {
-  assert(CachedCI);
+bool IDEInspectionInstance::shouldCheckDependencies(
+    const CachedCompilerInstance &Cached) const {
+  assert(Cached.CI);
   using namespace std::chrono;
   auto now = system_clock::now();
-  auto threshold = DependencyCheckedTimestamp +
+  auto threshold = Cached.DependencyCheckedTimestamp +
                    seconds(Opts.DependencyCheckIntervalSecond);
   return threshold <= now;
 }
@@ -335,11 +335,17 @@ void EnumPayload::emitSwitch(IRGenFunction &IGF,
 llvm::Value *
 EnumPayload::emitCompare(IRGenFunction &IGF,
                          const APInt &mask,
-                         const APInt &value) const {
-  // Succeed trivially for an empty payload, or if the payload is masked
-  // out completely.
+                         const APInt &value,
+                         llvm::CmpInst::Predicate predicate) const {
+  assert((predicate == llvm::CmpInst::ICMP_EQ ||
+          predicate == llvm::CmpInst::ICMP_NE) &&
+         "only equality comparisons are supported");
+  bool isNE = predicate == llvm::CmpInst::ICMP_NE;
+
+  // The equality succeeds trivially for an empty payload, or if the payload
+  // is masked out completely.
   if (PayloadValues.empty() || mask == 0)
-    return llvm::ConstantInt::get(IGF.IGM.Int1Ty, 1U);
+    return llvm::ConstantInt::get(IGF.IGM.Int1Ty, isNE ? 0U : 1U);
 
   assert((~mask & value) == 0
          && "value has masked out bits set?!");
@@ -379,9 +385,13 @@ EnumPayload::emitCompare(IRGenFunction &IGF,
     llvm::Value *valueConstant = llvm::ConstantInt::get(intTy, valuePiece);
     valueConstant = IGF.Builder.CreateBitOrPointerCast(valueConstant,
                                                        v->getType());
-    auto cmp = IGF.Builder.CreateICmpEQ(v, valueConstant);
+    auto cmp = IGF.Builder.CreateICmp(predicate, v, valueConstant);
     if (!condition)
       condition = cmp;
+    else if (isNE)
+      // By De Morgan, the negated comparison is the OR of the negated
+      // piecewise comparisons.
+      condition = IGF.Builder.CreateOr(condition, cmp);
     else
       condition = IGF.Builder.CreateAnd(condition, cmp);
   }
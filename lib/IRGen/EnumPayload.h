@@ -18,6 +18,7 @@
 #include "TypeInfo.h"
 #include "llvm/IR/BasicBlock.h"
 #include "llvm/IR/DerivedTypes.h"
+#include "llvm/IR/InstrTypes.h"
 #include "llvm/ADT/PointerEmbeddedInt.h"
 #include "llvm/ADT/PointerUnion.h"
 #include <utility>
@@ -147,9 +148,13 @@ public:
                   SwitchDefaultDest dflt) const;
   
   /// Emit an equality comparison operation that payload & mask == value.
-  llvm::Value *emitCompare(IRGenFunction &IGF,
-                           const APInt &mask,
-                           const APInt &value) const;
+  ///
+  /// Passing ICMP_NE emits the inverted comparison, payload & mask != value,
+  /// directly instead of negating the equality afterwards. This produces the
+  /// canonical null-check idiom for pointer-payload optionals.
+  llvm::Value *emitCompare(
+      IRGenFunction &IGF, const APInt &mask, const APInt &value,
+      llvm::CmpInst::Predicate predicate = llvm::CmpInst::ICMP_EQ) const;
   
   /// Apply an AND mask to the payload.
   void emitApplyAndMask(IRGenFunction &IGF, const APInt &mask);
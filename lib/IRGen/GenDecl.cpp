@@ -1417,7 +1417,9 @@ deleteAndReenqueueForEmissionValuesDependentOnCanonicalPrespecializedMetadataRec
 /// Emit any lazy definitions (of globals or functions or whatever
 /// else) that we require.
 void IRGenerator::emitLazyDefinitions() {
-  if (SIL.getASTContext().LangOpts.hasFeature(Feature::Embedded)) {
+  const bool isEmbedded =
+      SIL.getASTContext().LangOpts.hasFeature(Feature::Embedded);
+  if (isEmbedded) {
     // In embedded Swift, the compiler cannot emit any metadata, etc.
     assert(LazyTypeMetadata.empty());
     assert(LazySpecializedTypeMetadataRecords.empty());
@@ -1524,10 +1526,12 @@ void IRGenerator::emitLazyDefinitions() {
       // In embedded Swift, we can gain public / externally-visible functions
       // by deserializing them from imported modules, or by the CMO pass making
       // local functions public. TODO: We should internalize as a separate pass.
-      if (!SIL.getASTContext().LangOpts.hasFeature(Feature::Embedded)) {
+      if (!isEmbedded) {
         assert(!f->isPossiblyUsedExternally()
                && "function with externally-visible linkage emitted lazily?");
       }
+      if (auto *stats = SIL.getASTContext().Stats)
+        ++stats->getFrontendCounters().NumLazyFunctionDefinitionsEmitted;
       IGM->emitSILFunction(f);
     }
 
@@ -2133,8 +2133,31 @@ namespace {
         // and invert the result.
         assert(ElementsWithPayload.size() == 1 && "Should have one payload");
         if (ElementsWithNoPayload.size() == 1) {
-          auto *InvertedResult = emitValueCaseTest(IGF, value,
-                                                 ElementsWithNoPayload[0].decl);
+          auto *noPayloadCase = ElementsWithNoPayload[0].decl;
+
+          // With no extra tag bits, the payload case holds exactly the values
+          // that differ from the no-payload case's representation, so emit
+          // the inverted comparison directly. For a pointer-payload Optional
+          // this is the canonical null check (icmp ne %ptr, null) rather than
+          // a negated equality.
+          if (ExtraTagBitCount == 0) {
+            auto payload =
+                EnumPayload::fromExplosion(IGF.IGM, value, PayloadSchema);
+            APInt payloadTag, extraTag;
+            std::tie(payloadTag, extraTag) =
+                getNoPayloadCaseValue(noPayloadCase);
+            unsigned extraInhabitantCount =
+                getFixedExtraInhabitantCount(IGF.IGM);
+            auto &ti = getFixedPayloadTypeInfo();
+            return payload.emitCompare(
+                IGF,
+                extraInhabitantCount == 0
+                    ? APInt::getAllOnes(PayloadBitCount)
+                    : ti.getFixedExtraInhabitantMask(IGF.IGM),
+                payloadTag, llvm::CmpInst::ICMP_NE);
+          }
+
+          auto *InvertedResult = emitValueCaseTest(IGF, value, noPayloadCase);
           return IGF.Builder.CreateNot(InvertedResult);
         }
         
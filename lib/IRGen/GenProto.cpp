@@ -48,6 +48,7 @@
 #include "swift/SIL/SILWitnessVisitor.h"
 #include "swift/SIL/TypeLowering.h"
 #include "llvm/ADT/SmallString.h"
+#include "llvm/ADT/Statistic.h"
 #include "llvm/Support/raw_ostream.h"
 #include "llvm/IR/DerivedTypes.h"
 #include "llvm/IR/Function.h"
@@ -91,6 +92,13 @@
 using namespace swift;
 using namespace irgen;
 
+#define DEBUG_TYPE "polymorphic-convention"
+
+STATISTIC(NumConventionAnalysesComputed,
+          "# of polymorphic convention analyses computed");
+STATISTIC(NumConventionAnalysisCacheHits,
+          "# of polymorphic convention analysis cache hits");
+
 namespace {
 
 /// A class for computing how to pass arguments to a polymorphic
@@ -143,6 +151,11 @@ public:
 private:
   void initGenerics();
 
+  /// Compute Sources and Fulfillments for the function type. Only called on
+  /// a miss in the IGM's analysis cache.
+  void computeConvention(CanSILFunctionType fnType,
+                         bool considerParameterSources);
+
   template <typename ...Args>
   void considerNewTypeSource(IsExact_t isExact, MetadataSource::Kind kind,
                              CanType type, Args... args);
@@ -200,6 +213,33 @@ PolymorphicConvention::PolymorphicConvention(IRGenModule &IGM,
   : IGM(IGM), M(*IGM.getSwiftModule()), FnType(fnType){
   initGenerics();
 
+  // The analysis is a pure function of the function type, and the same
+  // signatures recur constantly -- most visibly once per apply site -- so
+  // memoize it in the IGM.
+  llvm::PointerIntPair<const SILFunctionType *, 1, bool>
+      cacheKey(fnType.getPointer(), considerParameterSources);
+  auto cached = IGM.PolymorphicConventionAnalyses.find(cacheKey);
+  if (cached != IGM.PolymorphicConventionAnalyses.end()) {
+    ++NumConventionAnalysisCacheHits;
+    Sources = cached->second->Sources;
+    Fulfillments = cached->second->Fulfillments;
+    return;
+  }
+
+  computeConvention(fnType, considerParameterSources);
+
+  ++NumConventionAnalysesComputed;
+  IGM.PolymorphicConventionAnalyses[cacheKey] =
+      new PolymorphicConventionAnalysis{Sources, Fulfillments};
+}
+
+void IRGenModule::destroyPolymorphicConventionAnalyses() {
+  for (auto &entry : PolymorphicConventionAnalyses)
+    delete entry.second;
+}
+
+void PolymorphicConvention::computeConvention(CanSILFunctionType fnType,
+                                              bool considerParameterSources) {
   auto rep = fnType->getRepresentation();
 
   if (fnType->isPseudogeneric()) {
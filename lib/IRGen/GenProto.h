@@ -53,6 +53,15 @@ namespace irgen {
   class ProtocolInfo;
   class TypeInfo;
 
+  /// The memoized result of analyzing how a polymorphic function type
+  /// sources its generic metadata: the metadata sources and the fulfillment
+  /// map computed by PolymorphicConvention. Cached per function type in the
+  /// IRGenModule, since the analysis depends on nothing else.
+  struct PolymorphicConventionAnalysis {
+    std::vector<MetadataSource> Sources;
+    FulfillmentMap Fulfillments;
+  };
+
   /// Set an LLVM value name for the given type metadata.
   void setTypeMetadataName(IRGenModule &IGM, llvm::Value *value, CanType type);
 
@@ -24,6 +24,7 @@
 #include "swift/AST/Types.h"
 #include "swift/Basic/Platform.h"
 #include "swift/Basic/SourceManager.h"
+#include "swift/Basic/Statistic.h"
 #include "swift/IRGen/Linking.h"
 #include "swift/SIL/SILModule.h"
 #include "llvm/IR/DerivedTypes.h"
@@ -60,6 +61,12 @@
 using namespace swift;
 using namespace irgen;
 
+#define DEBUG_TYPE "IRGen type info"
+STATISTIC(NumTypeInfoCacheHits, "# of type info cache hits");
+STATISTIC(NumTypeInfoExemplarHits,
+          "# of type info cache hits through an exemplar type");
+STATISTIC(NumTypeInfoConversions, "# of types converted to type info");
+
 Alignment IRGenModule::getCappedAlignment(Alignment align) {
   return std::min(align, Alignment(MaximumAlignment));
 }
@@ -2045,6 +2052,7 @@ const TypeInfo *TypeConverter::getTypeEntry(CanType canonicalTy) {
   {
     auto it = Cache.find(canonicalTy.getPointer());
     if (it != Cache.end()) {
+      ++NumTypeInfoCacheHits;
       return it->second;
     }
   }
@@ -2071,11 +2079,13 @@ const TypeInfo *TypeConverter::getTypeEntry(CanType canonicalTy) {
       // Record the object under the original type.
       auto result = it->second;
       Cache[canonicalTy.getPointer()] = result;
+      ++NumTypeInfoExemplarHits;
       return result;
     }
   }
 
   // Convert the type.
+  ++NumTypeInfoConversions;
   auto *convertedTI = convertType(exemplarTy);
 
   // Cache the entry under the original type and the exemplar type, so that
@@ -2325,6 +2325,10 @@ createSpecializedStructOrClassType(NominalOrBoundGenericNominalType *Type,
       if (llvm::Metadata *CachedTy = DIRefMap.lookup(UID)) {
         auto DITy = cast<llvm::DIType>(CachedTy);
         assert(sanityCheckCachedType(DbgTy, DITy));
+        // Remember the result under this TypeBase pointer, too. Equal types
+        // are not pointer-unique, so the same pointer would otherwise pay for
+        // the mangling again on every subsequent query.
+        DITypeCache[DbgTy.getType()] = llvm::TrackingMDNodeRef(DITy);
         return DITy;
       }
     }
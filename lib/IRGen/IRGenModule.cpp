@@ -776,6 +776,7 @@ IRGenModule::IRGenModule(IRGenerator &irgen,
 
 IRGenModule::~IRGenModule() {
   destroyMetadataLayoutMap();
+  destroyPolymorphicConventionAnalyses();
   destroyPointerAuthCaches();
   delete &Types;
 }
@@ -1237,8 +1238,12 @@ IRGenModule::createStringConstant(StringRef Str, bool willBeRelativelyAddressed,
   // rdar://problem/22674524
   // If we intend to relatively address this string, don't mark it with
   // unnamed_addr to prevent it from going into the cstrings section and getting
-  // coalesced.
-  if (!willBeRelativelyAddressed)
+  // coalesced. This only affects Mach-O; other linkers resolve relative
+  // references to merged strings correctly, and coalescing the per-module
+  // copies of reflection field names and similar strings is a significant
+  // size win there.
+  if (!willBeRelativelyAddressed ||
+      TargetInfo.OutputObjectFormat != llvm::Triple::MachO)
     global->setUnnamedAddr(llvm::GlobalValue::UnnamedAddr::Global);
 
   if (!sectionName.empty())
@@ -153,6 +153,7 @@ namespace irgen {
   class NominalMetadataLayout;
   class OutliningMetadataCollector;
   class PointerAuthEntity;
+  struct PolymorphicConventionAnalysis;
   class ProtocolInfo;
   enum class ProtocolInfoKind : uint8_t;
   class Signature;
@@ -1139,6 +1140,17 @@ private:
   llvm::DenseMap<Decl*, MetadataLayout*> MetadataLayouts;
   void destroyMetadataLayoutMap();
 
+public:
+  /// Memoized analyses of how polymorphic function signatures source their
+  /// generic metadata, keyed by the function type and whether parameter
+  /// sources were considered. See PolymorphicConvention in GenProto.cpp.
+  llvm::DenseMap<llvm::PointerIntPair<const SILFunctionType *, 1, bool>,
+                 PolymorphicConventionAnalysis *>
+      PolymorphicConventionAnalyses;
+
+private:
+  void destroyPolymorphicConventionAnalyses();
+
   llvm::DenseMap<const ProtocolConformance *,
                  std::unique_ptr<const ConformanceInfo>> Conformances;
 
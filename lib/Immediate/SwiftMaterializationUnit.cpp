@@ -350,7 +350,14 @@ void LazySwiftMaterializationUnit::materialize(
   // emitted during IRGen.
   SM->promoteLinkages();
 
-  runSILDiagnosticPasses(*SM);
+  // Errors from the mandatory passes (e.g. definite initialization) surface
+  // here rather than up front, since the SIL pipeline runs per requested
+  // symbol. Bail out like we do for type errors above instead of running
+  // invalid code.
+  if (runSILDiagnosticPasses(*SM)) {
+    MR->failMaterialization();
+    return;
+  }
   runSILLoweringPasses(*SM);
   auto GM = generateModule(CI, std::move(SM));
   if (!GM) {
@@ -299,8 +299,9 @@ static bool writeRecord(SymbolTracker &record, std::string Filename,
     break;
   }
 
+  SmallVector<clang::index::writer::SymbolRelation, 3> relations;
   for (auto &occurrence : record.getOccurrences()) {
-    SmallVector<clang::index::writer::SymbolRelation, 3> relations;
+    relations.clear();
     for(SymbolTracker::SymbolRelation symbolRelation: occurrence.related) {
       relations.push_back({record.getSymbol(symbolRelation.symbolIndex), symbolRelation.roles});
     }
@@ -98,6 +98,7 @@ performRRNOptimization(DenseMap<Value *, LocalState> &PtrToLocalStateMap) {
   for (auto &P : PtrToLocalStateMap) {
     auto &RetainList = P.second.RetainList;
     if (RetainList.size() > 1) {
+      Changed = true;
       // Create the retainN call right by the first retain.
       B.setInsertPoint(RetainList[0]);
       O = RetainList[0]->getArgOperand(0);
@@ -123,6 +124,7 @@ performRRNOptimization(DenseMap<Value *, LocalState> &PtrToLocalStateMap) {
 
     auto &ReleaseList = P.second.ReleaseList;
     if (ReleaseList.size() > 1) {
+      Changed = true;
       // Create the releaseN call right by the last release.
       auto *OldCI = ReleaseList[ReleaseList.size() - 1];
       B.setInsertPoint(OldCI);
@@ -148,6 +150,7 @@ performRRNOptimization(DenseMap<Value *, LocalState> &PtrToLocalStateMap) {
 
     auto &UnknownObjectRetainList = P.second.UnknownObjectRetainList;
     if (UnknownObjectRetainList.size() > 1) {
+      Changed = true;
       // Create the retainN call right by the first retain.
       B.setInsertPoint(UnknownObjectRetainList[0]);
       O = UnknownObjectRetainList[0]->getArgOperand(0);
@@ -174,6 +177,7 @@ performRRNOptimization(DenseMap<Value *, LocalState> &PtrToLocalStateMap) {
 
     auto &UnknownObjectReleaseList = P.second.UnknownObjectReleaseList;
     if (UnknownObjectReleaseList.size() > 1) {
+      Changed = true;
       // Create the releaseN call right by the last release.
       auto *OldCI =
           UnknownObjectReleaseList[UnknownObjectReleaseList.size() - 1];
@@ -201,6 +205,7 @@ performRRNOptimization(DenseMap<Value *, LocalState> &PtrToLocalStateMap) {
 
     auto &BridgeRetainList = P.second.BridgeRetainList;
     if (BridgeRetainList.size() > 1) {
+      Changed = true;
       // Create the releaseN call right by the first retain.
       auto *OldCI = BridgeRetainList[0];
       B.setInsertPoint(OldCI);
@@ -234,6 +239,7 @@ performRRNOptimization(DenseMap<Value *, LocalState> &PtrToLocalStateMap) {
 
     auto &BridgeReleaseList = P.second.BridgeReleaseList;
     if (BridgeReleaseList.size() > 1) {
+      Changed = true;
       // Create the releaseN call right by the last release.
       auto *OldCI = BridgeReleaseList[BridgeReleaseList.size() - 1];
       B.setInsertPoint(OldCI);
@@ -349,7 +355,15 @@ bool SwiftARCContractImpl::run() {
 
       if (Kind != RT_Unknown)
         continue;
-      
+
+      // Unknown non-call instructions (loads, stores, ...) cannot observe
+      // reference counts, and merging only ever moves retains earlier and
+      // releases later, which may extend an object's lifetime but never
+      // shortens it. Keep batching across them; only unknown calls below
+      // force the state to be flushed.
+      if (!isa<CallBase>(Inst))
+        continue;
+
       // If we have an unknown call, we need to create any retainN calls we
       // have seen. The reason why is that we do not want to move retains,
       // releases over isUniquelyReferenced calls. Specifically imagine this:
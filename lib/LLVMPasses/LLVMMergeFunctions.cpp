@@ -55,6 +55,7 @@
 #include "llvm/Support/CommandLine.h"
 #include "llvm/Support/Debug.h"
 #include "llvm/Support/ErrorHandling.h"
+#include "llvm/Support/Parallel.h"
 #include "llvm/Support/raw_ostream.h"
 #include <vector>
 
@@ -713,11 +714,26 @@ bool SwiftMergeFunctions::runOnModule(Module &M) {
   std::vector<std::pair<FunctionComparator::FunctionHash, Function *>>
     HashedFuncs;
 
-  for (Function &Func : M) {
-    if (isEligibleFunction(&Func)) {
-      HashedFuncs.push_back({FunctionComparator::functionHash(Func), &Func});
-    }
-  }
+  // The eligibility check and the hash computation both walk every
+  // instruction of every function, which dominates the pass on large WMO
+  // modules. Both are pure reads of the IR, so fan them out across threads.
+  // Results are collected per-index and compacted afterwards, which keeps the
+  // list in module order and the pass deterministic.
+  std::vector<Function *> Funcs;
+  Funcs.reserve(M.size());
+  for (Function &Func : M)
+    Funcs.push_back(&Func);
+
+  HashedFuncs.resize(Funcs.size());
+  llvm::parallelFor(0, Funcs.size(), [&](size_t I) {
+    Function *F = Funcs[I];
+    if (isEligibleFunction(F))
+      HashedFuncs[I] = {FunctionComparator::functionHash(*F), F};
+    else
+      HashedFuncs[I] = {0, nullptr};
+  });
+  llvm::erase_if(HashedFuncs,
+                 [](const auto &Entry) { return Entry.second == nullptr; });
 
   std::stable_sort(
       HashedFuncs.begin(), HashedFuncs.end(),
@@ -18,8 +18,8 @@
 #include "swift/Basic/Range.h"
 #include "llvm/ADT/SmallString.h"
 #include "llvm/ADT/StringRef.h"
-#include "llvm/Bitstream/BitstreamReader.h"
 #include "llvm/Support/CommandLine.h"
+#include "llvm/Support/EndianStream.h"
 #include "llvm/Support/FileSystem.h"
 #include "llvm/Support/MemoryBuffer.h"
 #include "llvm/Support/Path.h"
@@ -51,7 +51,10 @@ namespace diag {
 
 void SerializedLocalizationWriter::insert(swift::DiagID id,
                                           llvm::StringRef translation) {
-  generator.insert(static_cast<uint32_t>(id), translation);
+  auto index = static_cast<uint32_t>(id);
+  if (Translations.size() <= index)
+    Translations.resize(index + 1);
+  Translations[index] = translation.str();
 }
 
 bool SerializedLocalizationWriter::emit(llvm::StringRef filePath) {
@@ -62,13 +65,16 @@ bool SerializedLocalizationWriter::emit(llvm::StringRef filePath) {
     return true;
   }
 
-  offset_type offset;
-  {
-    llvm::support::endian::write<offset_type>(OS, 0, llvm::support::little);
-    offset = generator.Emit(OS);
+  endian::write<uint32_t>(OS, serializedLocalizationMagic, little);
+  endian::write<uint32_t>(OS, serializedLocalizationVersion, little);
+  endian::write<uint32_t>(OS, Translations.size(), little);
+  uint32_t offset = 0;
+  for (const auto &translation : Translations) {
+    offset += translation.size();
+    endian::write<uint32_t>(OS, offset, little);
   }
-  OS.seek(0);
-  llvm::support::endian::write(OS, offset, llvm::support::little);
+  for (const auto &translation : Translations)
+    OS << translation;
   OS.close();
 
   return OS.has_error();
@@ -114,20 +120,38 @@ SerializedLocalizationProducer::SerializedLocalizationProducer(
 }
 
 bool SerializedLocalizationProducer::initializeImpl() {
-  auto base =
-      reinterpret_cast<const unsigned char *>(Buffer.get()->getBufferStart());
-  auto tableOffset = endian::read<offset_type>(base, little);
-  SerializedTable.reset(SerializedLocalizationTable::Create(
-      base + tableOffset, base + sizeof(offset_type), base));
-  return true;
+  auto contents = Buffer.get()->getBuffer();
+
+  // Reject files which predate the direct-index format or which are
+  // truncated; the diagnostic engine then falls back to the compiled-in
+  // messages.
+  constexpr uint64_t headerSize = 3 * sizeof(uint32_t);
+  if (contents.size() < headerSize)
+    return false;
+  auto base = reinterpret_cast<const unsigned char *>(contents.data());
+  if (endian::read<uint32_t>(base, little) != serializedLocalizationMagic ||
+      endian::read<uint32_t>(base + 4, little) != serializedLocalizationVersion)
+    return false;
+
+  Count = endian::read<uint32_t>(base + 8, little);
+  uint64_t offsetsEnd = headerSize + uint64_t(Count) * sizeof(uint32_t);
+  if (contents.size() < offsetsEnd)
+    return false;
+
+  Offsets = reinterpret_cast<const ulittle32_t *>(base + headerSize);
+  Blob = contents.data() + offsetsEnd;
+  uint64_t blobSize = Count == 0 ? 0 : uint64_t(Offsets[Count - 1]);
+  return contents.size() - offsetsEnd >= blobSize;
 }
 
 llvm::StringRef
 SerializedLocalizationProducer::getMessage(swift::DiagID id) const {
-  auto value = SerializedTable.get()->find(id);
-  if (value.getDataLen() == 0)
+  auto index = static_cast<uint32_t>(id);
+  if (index >= Count)
     return llvm::StringRef();
-  return {(const char *)value.getDataPtr(), value.getDataLen()};
+  uint32_t begin = index == 0 ? 0 : Offsets[index - 1];
+  uint32_t end = Offsets[index];
+  return llvm::StringRef(Blob + begin, end - begin);
 }
 
 std::unique_ptr<LocalizationProducer>
@@ -140,7 +164,12 @@ LocalizationProducer::producerFor(llvm::StringRef locale, llvm::StringRef path,
   // If the serialized diagnostics file not available,
   // fallback to the `.strings` file.
   if (llvm::sys::fs::exists(filePath)) {
-    if (auto file = llvm::MemoryBuffer::getFile(filePath)) {
+    // Map the table read-only, without requiring a null terminator (which
+    // would force a copy), so every concurrent frontend job shares the same
+    // physical pages.
+    if (auto file = llvm::MemoryBuffer::getFile(filePath, /*IsText=*/false,
+                                                /*RequiresNullTerminator=*/
+                                                false)) {
       return std::make_unique<diag::SerializedLocalizationProducer>(
           std::move(file.get()), printDiagnosticNames);
     }
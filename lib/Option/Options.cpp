@@ -26,6 +26,14 @@ using namespace llvm::opt;
 #include "swift/Option/Options.inc"
 #undef PREFIX
 
+static constexpr const llvm::StringLiteral PrefixTable_init[] =
+#define PREFIX_UNION(VALUES) VALUES
+#include "swift/Option/Options.inc"
+#undef PREFIX_UNION
+    ;
+static constexpr const llvm::ArrayRef<llvm::StringLiteral>
+    PrefixTable(PrefixTable_init, std::size(PrefixTable_init) - 1);
+
 static const llvm::opt::GenericOptTable::Info InfoTable[] = {
 #define OPTION(PREFIX, NAME, ID, KIND, GROUP, ALIAS, ALIASARGS, FLAGS, PARAM,  \
                HELPTEXT, METAVAR, VALUES)                                      \
@@ -37,13 +45,15 @@ static const llvm::opt::GenericOptTable::Info InfoTable[] = {
 
 namespace {
 
-class SwiftOptTable : public llvm::opt::GenericOptTable {
+// Use a table with the prefix union precomputed by tablegen, so constructing
+// it doesn't redo that work in every process that parses arguments.
+class SwiftOptTable : public llvm::opt::PrecomputedOptTable {
 public:
-  SwiftOptTable() : GenericOptTable(InfoTable) {}
+  SwiftOptTable() : PrecomputedOptTable(InfoTable, PrefixTable) {}
 };
 
 } // end anonymous namespace
 
 std::unique_ptr<OptTable> swift::createSwiftOptTable() {
-  return std::unique_ptr<GenericOptTable>(new SwiftOptTable());
+  return std::unique_ptr<OptTable>(new SwiftOptTable());
 }
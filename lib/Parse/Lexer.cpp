@@ -367,12 +367,35 @@ static void diagnoseEmbeddedNul(DiagnosticEngine *Diags, const char *Ptr) {
       .fixItRemoveChars(NulLoc, NulEndLoc);
 }
 
+/// Skip over a run of bytes that cannot affect comment lexing: anything
+/// other than newlines, NULs, comment markers and, when UTF-8 is being
+/// diagnosed, non-ASCII bytes. The byte-wise loop is free of side effects
+/// and loop-carried dependencies, so optimizing builds vectorize it; this
+/// is where comment-heavy generated sources spend most of their lex time.
+static const char *skipOverPlainBytes(const char *Ptr, const char *End,
+                                      bool StopAtCommentMarkers,
+                                      bool StopAtNonASCII) {
+  for (; Ptr < End; ++Ptr) {
+    unsigned char C = *Ptr;
+    if (C == 0 || C == '\n' || C == '\r')
+      break;
+    if (StopAtCommentMarkers && (C == '*' || C == '/'))
+      break;
+    if (StopAtNonASCII && C >= 0x80)
+      break;
+  }
+  return Ptr;
+}
+
 /// Advance \p CurPtr to the end of line or the end of file. Returns \c true
 /// if it stopped at the end of line, \c false if it stopped at the end of file.
 static bool advanceToEndOfLine(const char *&CurPtr, const char *BufferEnd,
                                const char *CodeCompletionPtr = nullptr,
                                DiagnosticEngine *Diags = nullptr) {
   while (1) {
+    CurPtr = skipOverPlainBytes(CurPtr, BufferEnd,
+                                /*StopAtCommentMarkers=*/false,
+                                /*StopAtNonASCII=*/Diags != nullptr);
     switch (*CurPtr++) {
     case '\n':
     case '\r':
@@ -439,6 +462,9 @@ static bool skipToEndOfSlashStarComment(const char *&CurPtr,
   bool isMultiline = false;
 
   while (1) {
+    CurPtr = skipOverPlainBytes(CurPtr, BufferEnd,
+                                /*StopAtCommentMarkers=*/true,
+                                /*StopAtNonASCII=*/Diags != nullptr);
     switch (*CurPtr++) {
     case '*':
       // Check for a '*/'
@@ -657,6 +683,13 @@ void Lexer::lexIdentifier() {
   (void) didStart;
 
   // Lex [a-zA-Z_$0-9[[:XID_Continue:]]]*
+  //
+  // Identifiers are almost always plain ASCII, so eat those in a tight
+  // byte loop that skips UTF-8 validation; the general loop below picks
+  // up any non-ASCII continuation.
+  while (CurPtr < BufferEnd &&
+         clang::isAsciiIdentifierContinue(*CurPtr, /*dollar*/ true))
+    ++CurPtr;
   while (advanceIfValidContinuationOfIdentifier(CurPtr, BufferEnd));
 
   tok Kind = kindOfIdentifier(StringRef(TokStart, CurPtr-TokStart),
@@ -2446,8 +2479,32 @@ StringRef Lexer::getEncodedStringSegmentImpl(StringRef Bytes,
   if (IndentToStrip == ~0U)
     IndentToStrip = getMultilineTrailingIndent(Bytes).size();
 
+  // Only backslashes and newlines need decoding work below; everything else
+  // is copied through verbatim.
+  auto findNextSpecial = [](const char *Ptr, const char *End) -> const char * {
+    StringRef Rest(Ptr, End - Ptr);
+    size_t Offset = Rest.find_first_of(StringRef("\\\r\n", 3));
+    return Offset == StringRef::npos ? End : Ptr + Offset;
+  };
+
+  // Fast path: a segment with no backslash and no newline decodes to itself,
+  // so the original source bytes can be returned without copying anything.
+  // This is the common case for generated files with very large literals.
+  if (findNextSpecial(BytesPtr, Bytes.end()) == Bytes.end())
+    return Bytes;
+
   bool IsEscapedNewline = false;
   while (BytesPtr < Bytes.end()) {
+    // Bulk-copy the plain run up to the next special character rather than
+    // appending it byte by byte.
+    const char *NextSpecial = findNextSpecial(BytesPtr, Bytes.end());
+    if (NextSpecial != BytesPtr) {
+      TempString.append(BytesPtr, NextSpecial);
+      BytesPtr = NextSpecial;
+      if (BytesPtr == Bytes.end())
+        break;
+    }
+
     char CurChar = *BytesPtr++;
 
     // Multiline string line ending normalization and indent stripping.
@@ -7120,6 +7120,10 @@ bool Parser::delayParsingDeclList(SourceLoc LBLoc, SourceLoc &RBLoc,
                                   IterableDeclContext *IDC) {
   bool error = false;
 
+  if (auto *stat = Context.Stats) {
+    ++stat->getFrontendCounters().NumIterableDeclContextDelayed;
+  }
+
   if (Tok.is(tok::r_brace)) {
     RBLoc = consumeToken();
   } else {
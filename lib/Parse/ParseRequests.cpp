@@ -110,10 +110,12 @@ ParseAbstractFunctionBodyRequest::evaluate(Evaluator &evaluator,
 
   case BodyKind::Unparsed: {
     // FIXME: How do we configure code completion?
+    // A delayed body was recorded while parsing this source file, so its
+    // range is in the file's own buffer; no need to search for it. The
+    // parser then restores the lexer directly at the body's '{' from the
+    // recorded range rather than re-scanning anything before it.
     SourceFile &sf = *afd->getDeclContext()->getParentSourceFile();
-    SourceManager &sourceMgr = sf.getASTContext().SourceMgr;
-    unsigned bufferID =
-        sourceMgr.findBufferContainingLoc(afd->getBodySourceRange().Start);
+    unsigned bufferID = *sf.getBufferID();
     Parser parser(bufferID, sf, /*SIL*/ nullptr);
     auto result = parser.parseAbstractFunctionBodyDelayed(afd);
     afd->setBodyKind(BodyKind::Parsed);
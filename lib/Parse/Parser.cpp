@@ -802,9 +802,32 @@ void Parser::skipUntilDeclRBrace(tok T1, tok T2) {
 }
 
 void Parser::skipUntilConditionalBlockClose() {
-  while (Tok.isNot(tok::pound_else, tok::pound_elseif, tok::pound_endif,
-                   tok::eof)) {
-    skipSingle();
+  // Skipped regions can be large, so consume tokens in a flat loop that only
+  // tracks '#if' nesting rather than recursing through skipSingle for every
+  // bracket. Bracket matching doesn't affect where the skip stops; only the
+  // conditional-compilation directives do.
+  unsigned nesting = 0;
+  while (true) {
+    switch (Tok.getKind()) {
+    case tok::pound_if:
+      ++nesting;
+      break;
+    case tok::pound_else:
+    case tok::pound_elseif:
+      if (nesting == 0)
+        return;
+      break;
+    case tok::pound_endif:
+      if (nesting == 0)
+        return;
+      --nesting;
+      break;
+    case tok::eof:
+      return;
+    default:
+      break;
+    }
+    consumeToken();
   }
 }
 
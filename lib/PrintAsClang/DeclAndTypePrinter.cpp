@@ -2925,16 +2925,23 @@ static bool isEnumExposableToCxx(const ValueDecl *VD,
 }
 
 bool DeclAndTypePrinter::shouldInclude(const ValueDecl *VD) {
-  return !VD->isInvalid() && (!requiresExposedAttribute || hasExposeAttr(VD)) &&
-         (outputLang == OutputLanguageMode::Cxx
-              ? cxx_translation::isVisibleToCxx(VD, minRequiredAccess) &&
-                    isExposedToThisModule(M, VD, exposedModules) &&
-                    cxx_translation::isExposableToCxx(VD) &&
-                    isEnumExposableToCxx(VD, *this)
-              : isVisibleToObjC(VD, minRequiredAccess)) &&
-         !VD->getAttrs().hasAttribute<ImplementationOnlyAttr>() &&
-         !isAsyncAlternativeOfOtherDecl(VD) &&
-         !excludeForObjCImplementation(VD);
+  auto cached = shouldIncludeCache.find(VD);
+  if (cached != shouldIncludeCache.end())
+    return cached->second;
+
+  bool result =
+      !VD->isInvalid() && (!requiresExposedAttribute || hasExposeAttr(VD)) &&
+      (outputLang == OutputLanguageMode::Cxx
+           ? cxx_translation::isVisibleToCxx(VD, minRequiredAccess) &&
+                 isExposedToThisModule(M, VD, exposedModules) &&
+                 cxx_translation::isExposableToCxx(VD) &&
+                 isEnumExposableToCxx(VD, *this)
+           : isVisibleToObjC(VD, minRequiredAccess)) &&
+      !VD->getAttrs().hasAttribute<ImplementationOnlyAttr>() &&
+      !isAsyncAlternativeOfOtherDecl(VD) &&
+      !excludeForObjCImplementation(VD);
+  shouldIncludeCache.insert({VD, result});
+  return result;
 }
 
 bool DeclAndTypePrinter::isVisible(const ValueDecl *vd) const {
@@ -18,6 +18,7 @@
 #include "swift/AST/Type.h"
 // for OptionalTypeKind
 #include "swift/ClangImporter/ClangImporter.h"
+#include "llvm/ADT/DenseMap.h"
 #include "llvm/ADT/StringSet.h"
 
 namespace clang {
@@ -73,6 +74,12 @@ private:
   /// Cached for convenience.
   Identifier ID_CFTypeRef;
 
+  /// Memoized results of \c shouldInclude. The exposure checks walk the
+  /// members and interface types of the declaration and the same declaration
+  /// is queried repeatedly while printing extensions, conformances, and
+  /// referenced types.
+  llvm::DenseMap<const ValueDecl *, bool> shouldIncludeCache;
+
   Implementation getImpl();
 
 public:
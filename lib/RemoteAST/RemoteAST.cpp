@@ -689,6 +689,18 @@ RemoteASTContext::getTypeForRemoteTypeMetadata(RemoteAddress address,
   return asImpl(Impl)->getTypeForRemoteTypeMetadata(address, skipArtificial);
 }
 
+std::vector<Result<Type>>
+RemoteASTContext::getTypesForRemoteTypeMetadata(
+    ArrayRef<RemoteAddress> addresses, bool skipArtificial) {
+  auto *impl = asImpl(Impl);
+  std::vector<Result<Type>> results;
+  results.reserve(addresses.size());
+  for (auto address : addresses)
+    results.push_back(
+        impl->getTypeForRemoteTypeMetadata(address, skipArtificial));
+  return results;
+}
+
 Result<MetadataKind>
 RemoteASTContext::getKindForRemoteTypeMetadata(remote::RemoteAddress address) {
   return asImpl(Impl)->getKindForRemoteTypeMetadata(address);
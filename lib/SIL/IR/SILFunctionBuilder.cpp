@@ -295,12 +295,12 @@ SILFunction *SILFunctionBuilder::getOrCreateFunction(
     llvm::function_ref<SILFunction *(SILLocation loc, SILDeclRef constant)>
         getOrCreateDeclaration,
     ProfileCounter entryCount) {
-  auto nameTmp = constant.mangle();
+  StringRef name = mod.getMangledName(constant);
   auto constantType = mod.Types.getConstantFunctionType(
       TypeExpansionContext::minimal(), constant);
   SILLinkage linkage = constant.getLinkage(forDefinition);
 
-  if (auto fn = mod.lookUpFunction(nameTmp)) {
+  if (auto fn = mod.lookUpFunction(name)) {
     // During SILGen (where the module's SIL stage is Raw), there might be
     // mismatches between the type or linkage. This can happen, when two
     // functions are mistakenly mapped to the same name (e.g. with @_cdecl).
@@ -341,7 +341,8 @@ SILFunction *SILFunctionBuilder::getOrCreateFunction(
   else if (constant.isAlwaysInline())
     inlineStrategy = AlwaysInline;
 
-  StringRef name = mod.allocateCopy(nameTmp);
+  // The name returned by getMangledName is already allocated on the module's
+  // allocator, so it can be handed to the function directly.
   IsDynamicallyReplaceable_t IsDyn = IsNotDynamic;
   if (constant.isDynamicallyReplaceable()) {
     IsDyn = IsDynamic;
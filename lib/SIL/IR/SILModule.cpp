@@ -18,6 +18,7 @@
 #include "swift/AST/Decl.h"
 #include "swift/AST/GenericEnvironment.h"
 #include "swift/AST/ProtocolConformance.h"
+#include "swift/Basic/Statistic.h"
 #include "swift/ClangImporter/ClangModule.h"
 #include "swift/SIL/FormalLinkage.h"
 #include "swift/SIL/Notifications.h"
@@ -160,6 +161,11 @@ SILModule::~SILModule() {
     F.eraseAllBlocks();
   }
   flushDeletedInsts();
+
+  for (auto &freeList : instFreeLists) {
+    for (char *base : freeList)
+      AlignedFree(base);
+  }
 }
 
 std::unique_ptr<SILModule> SILModule::createEmptyModule(
@@ -202,7 +208,38 @@ void SILModule::freeAllSlabs(SlabList &slabs) {
 }
 
 void *SILModule::allocateInst(unsigned Size, unsigned Align) const {
-  return AlignedAlloc(Size, Align);
+  assert(Align <= instAlignment && "instruction requires stronger alignment");
+
+  // Round up to the size class and try to pop a recycled allocation. Each
+  // allocation is preceded by a header recording its size class, so the
+  // memory can be returned to the right free list in deallocateInst.
+  unsigned roundedSize =
+      (Size + instSizeClassGranularity - 1) & ~(instSizeClassGranularity - 1);
+  unsigned sizeClass = roundedSize / instSizeClassGranularity;
+  if (sizeClass < numInstFreeLists && !instFreeLists[sizeClass].empty()) {
+    char *base = instFreeLists[sizeClass].pop_back_val();
+    return base + instAlignment;
+  }
+
+  char *base =
+      (char *)AlignedAlloc(roundedSize + instAlignment, instAlignment);
+  *reinterpret_cast<unsigned *>(base) = roundedSize;
+  return base + instAlignment;
+}
+
+void SILModule::deallocateInst(SILInstruction *I) {
+  char *base = (char *)I - instAlignment;
+  unsigned roundedSize = *reinterpret_cast<unsigned *>(base);
+
+  if (auto *stats = getASTContext().Stats)
+    stats->getFrontendCounters().NumSILInstructionBytesChurned += roundedSize;
+
+  unsigned sizeClass = roundedSize / instSizeClassGranularity;
+  if (sizeClass < numInstFreeLists) {
+    instFreeLists[sizeClass].push_back(base);
+    return;
+  }
+  AlignedFree(base);
 }
 
 void SILModule::willDeleteInstruction(SILInstruction *I) {
@@ -226,7 +263,7 @@ void SILModule::scheduleForDeletion(SILInstruction *I) {
 void SILModule::flushDeletedInsts() {
   for (SILInstruction *instToDelete : scheduledForDeletion) {
     SILInstruction::destroy(instToDelete);
-    AlignedFree(instToDelete);
+    deallocateInst(instToDelete);
   }
   scheduledForDeletion.clear();
 }
@@ -342,9 +379,21 @@ const BuiltinInfo &SILModule::getBuiltinInfo(Identifier ID) {
   return Info;
 }
 
+StringRef SILModule::getMangledName(SILDeclRef constant) {
+  auto known = MangledNameCache.find(constant);
+  if (known != MangledNameCache.end())
+    return known->second;
+
+  // Mangle before inserting; mangling recurses into other declaration
+  // references and must not hold an iterator into the cache.
+  std::string name = constant.mangle();
+  StringRef stableName = allocateCopy(name);
+  MangledNameCache.insert({constant, stableName});
+  return stableName;
+}
+
 SILFunction *SILModule::lookUpFunction(SILDeclRef fnRef) {
-  auto name = fnRef.mangle();
-  return lookUpFunction(name);
+  return lookUpFunction(getMangledName(fnRef));
 }
 
 bool SILModule::loadFunction(SILFunction *F, LinkingMode LinkMode) {
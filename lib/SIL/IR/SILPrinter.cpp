@@ -649,6 +649,12 @@ class SILPrinter : public SILInstructionVisitor<SILPrinter> {
   LineComments lineComments;
   unsigned LastBufferID;
 
+  /// Memoized text of the raw AST types printed for SILTypes. Operand types
+  /// repeat constantly within a function and the AST printer walk dominates
+  /// large -emit-sil dumps; the printing options are fixed at construction,
+  /// so the text for a given type never changes within one printer.
+  llvm::DenseMap<TypeBase *, std::string> TypeTextCache;
+
   // Printers for the underlying stream.
 #define SIMPLE_PRINTER(TYPE) \
   SILPrinter &operator<<(TYPE value) { \
@@ -711,7 +717,13 @@ class SILPrinter : public SILInstructionVisitor<SILPrinter> {
   
   SILPrinter &operator<<(SILType t) {
     printSILTypeColorAndSigil(PrintState.OS, t);
-    t.getRawASTType().print(PrintState.OS, PrintState.ASTOptions);
+    auto rawType = t.getRawASTType();
+    auto &text = TypeTextCache[rawType.getPointer()];
+    if (text.empty()) {
+      llvm::raw_string_ostream textOS(text);
+      rawType.print(textOS, PrintState.ASTOptions);
+    }
+    PrintState.OS << text;
     return *this;
   }
   
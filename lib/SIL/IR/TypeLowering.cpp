@@ -41,12 +41,16 @@
 #include "swift/SIL/SILModule.h"
 #include "swift/SIL/Test.h"
 #include "clang/AST/Type.h"
+#include "llvm/ADT/Statistic.h"
 #include "llvm/Support/Compiler.h"
 #include "llvm/Support/Debug.h"
 
 using namespace swift;
 using namespace Lowering;
 
+STATISTIC(NumTypeLoweringCacheHits, "# of type lowering cache hits");
+STATISTIC(NumTypeLoweringCacheMisses, "# of type lowering cache misses");
+
 // Necessary to straightforwardly write SIL tests that exercise
 // OpaqueValueTypeLowering (and MoveOnlyOpaqueValueTypeLowering): the tests can
 // be written as though opaque values were enabled to begin but have since been
@@ -2636,11 +2640,14 @@ const TypeLowering *TypeConverter::find(const TypeKey &k) {
 
   auto ck = k.getCachingKey();
   auto found = LoweredTypes.find(ck);
-  if (found == LoweredTypes.end())
+  if (found == LoweredTypes.end()) {
+    ++NumTypeLoweringCacheMisses;
     return nullptr;
+  }
 
   assert((found->second || k.expansionContext.isMinimal()) &&
          "type recursion not caught in Sema");
+  ++NumTypeLoweringCacheHits;
   return found->second;
 }
 
@@ -42,6 +42,18 @@ enum IsFreeFunctionWitness_t : bool {
 };
 
 /// An ASTVisitor for generating SIL from top-level declarations in a module.
+///
+/// Emission is strictly single-threaded, and has to be: every function is
+/// emitted into one shared SILModule, type lowering caches live in the shared
+/// TypeConverter, and SILGen of one declaration routinely forces emission of
+/// others mid-stream (delayed functions, witness tables pumped from
+/// \c pendingForcedFunctions and \c pendingConformances), all of which
+/// allocates from the single ASTContext. Parallelism in the compilation
+/// pipeline instead lives downstream, where IRGen splits the SILModule into
+/// independent LLVM modules (see performParallelIRGeneration). Output order
+/// is nonetheless deterministic even for demand-forced functions:
+/// \c delayedFunctions records where each delayed function would have been
+/// emitted, and forcing one splices it back into that position.
 class LLVM_LIBRARY_VISIBILITY SILGenModule : public ASTVisitor<SILGenModule> {
 public:
   /// The Module being constructed.
@@ -4571,6 +4571,14 @@ RValue RValueEmitter::visitCollectionExpr(CollectionExpr *E, SGFContext C) {
   auto loc = SILLocation(E);
   ArgumentScope scope(SGF, loc);
 
+  // Note that this does not try to emit all-constant literals as statically
+  // initialized globals directly: the layout of the array's storage class is
+  // owned by the standard library, so forming it here would hard-code that
+  // layout into SILGen. Instead we emit one allocation call plus direct
+  // element stores (no per-element appends), and the ObjectOutliner pass
+  // folds all-constant arrays into statically initialized objects handed to
+  // swift_initStaticObject when optimization is enabled.
+
   // CSApply builds ArrayExprs without an initializer for the trivial case
   // of emitting varargs.
   CanType arrayType, elementType;
@@ -665,6 +665,11 @@ namespace {
 class AliasAnalysisContainer : public FunctionAnalysisBase<AliasAnalysis> {
   SILPassManager *PM = nullptr;
 
+  /// Type aliasing relations never change, so the TBAA cache is owned here
+  /// and shared by all AliasAnalysis instances: it survives both function
+  /// invalidation and queries from different functions.
+  llvm::DenseMap<AliasAnalysis::TBAACacheKey, bool> TypesMayAliasCache;
+
 public:
   AliasAnalysisContainer() : FunctionAnalysisBase(SILAnalysisKind::Alias) {}
 
@@ -686,7 +691,7 @@ public:
   virtual std::unique_ptr<AliasAnalysis>
   newFunctionAnalysis(SILFunction *F) override {
     assert(PM && "dependent analysis not initialized");
-    return std::make_unique<AliasAnalysis>(PM);
+    return std::make_unique<AliasAnalysis>(PM, TypesMayAliasCache);
   }
 
   virtual void initialize(SILPassManager *PM) override {
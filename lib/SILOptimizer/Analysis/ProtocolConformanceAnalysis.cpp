@@ -105,6 +105,17 @@ ProtocolConformanceAnalysis::findSoleConformingType(ProtocolDecl *Protocol) {
   if (SoleConformingTypeIt != SoleConformingTypeCache.end())
     return SoleConformingTypeIt->second;
 
+  // Populate SoleConformingTypeCache with the outcome of the traversal below.
+  // Negative results are cached as null entries: the conformance set does not
+  // change during the SIL pipeline, so a protocol that has no sole conforming
+  // type now never gains one, and re-running the traversal for every failed
+  // devirtualization query would just re-derive the same answer.
+  auto cacheResult = [&](NominalTypeDecl *NTD) {
+    SoleConformingTypeCache.insert(
+        std::pair<ProtocolDecl *, NominalTypeDecl *>(Protocol, NTD));
+    return NTD;
+  };
+
   SmallVector<ProtocolDecl *, 8> PDWorkList;
   SmallPtrSet<ProtocolDecl *, 8> VisitedPDs;
   NominalTypeDecl *SoleConformingNTD = nullptr;
@@ -113,7 +124,7 @@ ProtocolConformanceAnalysis::findSoleConformingType(ProtocolDecl *Protocol) {
     auto *PD = PDWorkList.pop_back_val();
     // Protocols must have internal or lower access.
     if (PD->getEffectiveAccess() > AccessLevel::Internal) {
-      return nullptr;
+      return cacheResult(nullptr);
     }
     VisitedPDs.insert(PD);
     auto NTDList = getConformances(PD);
@@ -126,7 +137,7 @@ ProtocolConformanceAnalysis::findSoleConformingType(ProtocolDecl *Protocol) {
       } else { // Classes, Structs and Enums are added here.
         // Bail if more than one conforming types were found.
         if (SoleConformingNTD && ConformingNTD != SoleConformingNTD) {
-          return nullptr;
+          return cacheResult(nullptr);
         } else {
           SoleConformingNTD = ConformingNTD;
         }
@@ -136,19 +147,15 @@ ProtocolConformanceAnalysis::findSoleConformingType(ProtocolDecl *Protocol) {
 
   // Bail if we did not find a sole conforming type.
   if (!SoleConformingNTD)
-    return nullptr;
+    return cacheResult(nullptr);
 
   // Generic declarations are ignored.
   if (SoleConformingNTD->isGenericContext()) {
-    return nullptr;
+    return cacheResult(nullptr);
   }
 
-  // Populate SoleConformingTypeCache.
-  SoleConformingTypeCache.insert(std::pair<ProtocolDecl *, NominalTypeDecl *>(
-      Protocol, SoleConformingNTD));
-
   // Return SoleConformingNTD.
-  return SoleConformingNTD;
+  return cacheResult(SoleConformingNTD);
 }
 
 // Wrapper function to findSoleConformingType that checks for additional
@@ -40,6 +40,7 @@
 #include "swift/SILOptimizer/Utils/PartitionUtils.h"
 #include "swift/SILOptimizer/Utils/VariableNameUtils.h"
 #include "llvm/ADT/DenseMap.h"
+#include "llvm/ADT/Statistic.h"
 #include "llvm/Support/Debug.h"
 
 using namespace swift;
@@ -47,6 +48,13 @@ using namespace swift::PartitionPrimitives;
 using namespace swift::PatternMatch;
 using namespace swift::regionanalysisimpl;
 
+STATISTIC(NumFunctionsAnalyzed,
+          "# of functions region analysis computed regions for");
+STATISTIC(NumFunctionsUnsupported,
+          "# of functions region analysis skipped as unsupported");
+STATISTIC(NumDataflowBlockVisits,
+          "# of block visits while solving the region dataflow");
+
 //===----------------------------------------------------------------------===//
 //                              MARK: Utilities
 //===----------------------------------------------------------------------===//
@@ -3180,8 +3188,10 @@ RegionAnalysisFunctionInfo::RegionAnalysisFunctionInfo(
   // NOTE: See documentation on supportedFunction for criteria.
   if (!canComputeRegionsForFunction(fn)) {
     supportedFunction = false;
+    ++NumFunctionsUnsupported;
     return;
   }
+  ++NumFunctionsAnalyzed;
 
   translator = new (allocator)
       PartitionOpTranslator(fn, pofi, valueMap, isolationHistoryFactory);
@@ -3240,6 +3250,7 @@ void RegionAnalysisFunctionInfo::runDataflow() {
 
       // Mark this block as no longer needing an update.
       blockState.needsUpdate = false;
+      ++NumDataflowBlockVisits;
 
       // Compute the new entry partition to this block.
       Partition newEntryPartition = blockState.entryPartition;
@@ -11,6 +11,8 @@
 //===----------------------------------------------------------------------===//
 
 #define DEBUG_TYPE "sil-dead-function-elimination"
+#include "swift/AST/ASTContext.h"
+#include "swift/AST/DiagnosticsFrontend.h"
 #include "swift/AST/ProtocolConformance.h"
 #include "swift/SIL/InstructionUtils.h"
 #include "swift/SIL/PatternMatch.h"
@@ -22,8 +24,10 @@
 #include "llvm/ADT/SmallPtrSet.h"
 #include "llvm/ADT/SmallVector.h"
 #include "llvm/ADT/Statistic.h"
+#include "llvm/ADT/StringSet.h"
 #include "llvm/Support/CommandLine.h"
 #include "llvm/Support/Debug.h"
+#include "llvm/Support/MemoryBuffer.h"
 using namespace swift;
 
 STATISTIC(NumDeadFunc, "Number of dead functions eliminated");
@@ -90,6 +94,55 @@ class DeadFunctionAndGlobalElimination {
 
   bool keepExternalWitnessTablesAlive;
 
+  /// Mangled names a previous link actually referenced, loaded from the file
+  /// given by -linker-used-symbols-file. Not set if no file was given or it
+  /// could not be read.
+  std::optional<llvm::StringSet<>> LinkerUsedSymbols;
+
+  /// Loads the link-time symbol usage file, if one was requested.
+  void loadLinkerUsedSymbols() {
+    StringRef path = Module->getOptions().LinkerUsedSymbolsFile;
+    if (path.empty())
+      return;
+    auto buffer = llvm::MemoryBuffer::getFile(path);
+    if (!buffer) {
+      Module->getASTContext().Diags.diagnose(
+          SourceLoc(), diag::error_open_input_file, path,
+          buffer.getError().message());
+      return;
+    }
+    LinkerUsedSymbols.emplace();
+    SmallVector<StringRef, 64> lines;
+    (*buffer)->getBuffer().split(lines, '\n', /*MaxSplit=*/-1,
+                                 /*KeepEmpty=*/false);
+    for (StringRef line : lines)
+      LinkerUsedSymbols->insert(line.trim());
+  }
+
+  /// Returns true if the feedback file from a previous link proves that no
+  /// image referenced \p F. Such a function is not treated as a root; it
+  /// stays alive only if something in this module still uses it.
+  bool isUnreferencedAtLink(SILFunction *F) {
+    if (!LinkerUsedSymbols)
+      return false;
+    if (!F->isDefinition() || F->isAvailableExternally())
+      return false;
+    if (!hasPublicOrPackageVisibility(F->getLinkage(), /*includePackage=*/true))
+      return false;
+    // Keep everything reachable through channels the linker's symbol list
+    // does not record: the runtime, ObjC message sends, dynamic replacement,
+    // C code in the linkage unit, and the debugger.
+    if (F->hasCReferences() || F->markedAsUsed() || F->isRuntimeAccessible() ||
+        F->isDistributed() || F->isDynamicallyReplaceable() ||
+        F->getDynamicallyReplacedFunction() ||
+        F->getReferencedAdHocRequirementWitnessFunction() ||
+        F->hasPrespecialization() || F->markedAsAlwaysEmitIntoClient() ||
+        F->shouldBePreservedForDebugger() ||
+        F->getRepresentation() == SILFunctionTypeRepresentation::ObjCMethod)
+      return false;
+    return !LinkerUsedSymbols->contains(F->getName());
+  }
+
   /// Checks is a function is alive, e.g. because it is visible externally.
   bool isAnchorFunction(SILFunction *F) {
     // In embedded Swift, (even public) generic functions *after serialization*
@@ -100,6 +153,11 @@ class DeadFunctionAndGlobalElimination {
     if (embedded && generic && isSerialized)
       return false;
 
+    // A public function that the previous link demonstrably never referenced
+    // is not a root, even though it is visible externally.
+    if (isUnreferencedAtLink(F))
+      return false;
+
     // Functions that may be used externally cannot be removed.
     if (F->isPossiblyUsedExternally())
       return true;
@@ -714,7 +772,9 @@ public:
   DeadFunctionAndGlobalElimination(SILModule *module,
                                    bool keepExternalWitnessTablesAlive) :
     Module(module),
-    keepExternalWitnessTablesAlive(keepExternalWitnessTablesAlive) {}
+    keepExternalWitnessTablesAlive(keepExternalWitnessTablesAlive) {
+    loadLinkerUsedSymbols();
+  }
 
   /// The main entry point of the optimization.
   void eliminateFunctionsAndGlobals(SILModuleTransform *DFEPass) {
@@ -0,0 +1,85 @@
+//===--- ProfileGuidedSymbolOrdering.cpp - Emit a linker order file -------===//
+//
+// This source file is part of the Swift.org open source project
+//
+// Copyright (c) 2014 - 2025 Apple Inc. and the Swift project authors
+// Licensed under Apache License v2.0 with Runtime Library Exception
+//
+// See https://swift.org/LICENSE.txt for license information
+// See https://swift.org/CONTRIBUTORS.txt for the list of Swift project authors
+//
+//===----------------------------------------------------------------------===//
+//
+// Emits a linker order file from profile data. Each line of the output is
+// the mangled name of a function definition the profile saw executed, the
+// hottest first, in the format understood by ld64's -order_file option and
+// by lld's --symbol-ordering-file. Laying out hot functions contiguously
+// reduces the number of pages faulted in at startup.
+//
+// The pass only runs when an output path was requested via
+// -emit-symbol-order-path; it requires profile data loaded with
+// -profile-use, since functions without an entry count are skipped.
+//
+//===----------------------------------------------------------------------===//
+
+#define DEBUG_TYPE "profile-guided-symbol-ordering"
+
+#include "swift/AST/ASTContext.h"
+#include "swift/AST/DiagnosticsCommon.h"
+#include "swift/SIL/SILFunction.h"
+#include "swift/SIL/SILModule.h"
+#include "swift/SILOptimizer/PassManager/Passes.h"
+#include "swift/SILOptimizer/PassManager/Transforms.h"
+#include "llvm/ADT/SmallVector.h"
+#include "llvm/Support/FileSystem.h"
+#include "llvm/Support/raw_ostream.h"
+
+using namespace swift;
+
+namespace {
+
+class ProfileGuidedSymbolOrdering : public SILModuleTransform {
+  void run() override {
+    SILModule *M = getModule();
+    StringRef path = M->getOptions().SymbolOrderFile;
+    if (path.empty())
+      return;
+
+    // Collect the definitions the profile saw executed. Functions without an
+    // entry count are left out: the linker keeps its default layout for any
+    // symbol that does not appear in the order file.
+    SmallVector<std::pair<uint64_t, const SILFunction *>, 64> hotFunctions;
+    for (const SILFunction &F : *M) {
+      if (!F.isDefinition())
+        continue;
+      ProfileCounter entryCount = F.getEntryCount();
+      if (!entryCount.hasValue() || entryCount.getValue() == 0)
+        continue;
+      hotFunctions.push_back({entryCount.getValue(), &F});
+    }
+
+    // Hottest first. The sort is stable so that functions with equal counts
+    // keep their module order and the output is deterministic.
+    std::stable_sort(hotFunctions.begin(), hotFunctions.end(),
+                     [](const auto &lhs, const auto &rhs) {
+                       return lhs.first > rhs.first;
+                     });
+
+    std::error_code error;
+    llvm::raw_fd_ostream out(path, error, llvm::sys::fs::OF_None);
+    if (error) {
+      M->getASTContext().Diags.diagnose(
+          SourceLoc(), diag::error_opening_output, path, error.message());
+      return;
+    }
+
+    for (const auto &entry : hotFunctions)
+      out << entry.second->getName() << "\n";
+  }
+};
+
+} // end anonymous namespace
+
+SILTransform *swift::createProfileGuidedSymbolOrdering() {
+  return new ProfileGuidedSymbolOrdering();
+}
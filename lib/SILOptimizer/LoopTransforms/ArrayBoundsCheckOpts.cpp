@@ -39,6 +39,7 @@
 #include "llvm/ADT/DepthFirstIterator.h"
 #include "llvm/ADT/PointerIntPair.h"
 #include "llvm/ADT/SmallPtrSet.h"
+#include "llvm/ADT/Statistic.h"
 #include "llvm/ADT/StringExtras.h"
 #include "llvm/ADT/StringSwitch.h"
 #include "llvm/Support/Allocator.h"
@@ -51,6 +52,10 @@
 using namespace swift;
 using namespace PatternMatch;
 
+STATISTIC(NumBoundsChecksRemoved, "Number of bounds checks removed");
+STATISTIC(NumBoundsChecksHoisted,
+          "Number of bounds checks hoisted out of loops");
+
 static llvm::cl::opt<bool> ShouldReportBoundsChecks("sil-abcopts-report",
                                               llvm::cl::init(false));
 
@@ -1096,6 +1101,7 @@ bool ABCOpt::removeRedundantChecksInBlock(SILBasicBlock &BB) {
 
     // Remove the bounds check.
     ArrayCall.removeCall();
+    ++NumBoundsChecksRemoved;
     Changed = true;
   }
   return Changed;
@@ -1161,6 +1167,7 @@ bool ABCOpt::removeRedundantChecksInLoop(DominanceInfoNode *CurBB,
 
     // Remove the bounds check.
     ArrayCall.removeCall();
+    ++NumBoundsChecksRemoved;
     Changed = true;
   }
 
@@ -1385,6 +1392,7 @@ bool ABCOpt::hoistChecksInLoop(DominanceInfoNode *DTNode, ABCAnalysis &ABC,
              "Must be able to hoist the instruction.");
       Changed = true;
       ArrayCall.hoist(Preheader->getTerminator(), DT);
+      ++NumBoundsChecksHoisted;
       LLVM_DEBUG(llvm::dbgs()
                  << " could hoist invariant bounds check: " << *Inst);
       continue;
@@ -1406,6 +1414,7 @@ bool ABCOpt::hoistChecksInLoop(DominanceInfoNode *DTNode, ABCAnalysis &ABC,
       // dominate the loop exit block.
       Changed = true;
       ArrayCall.removeCall();
+      ++NumBoundsChecksRemoved;
       LLVM_DEBUG(llvm::dbgs() << "  Bounds check removed\n");
       continue;
     }
@@ -1423,6 +1432,7 @@ bool ABCOpt::hoistChecksInLoop(DominanceInfoNode *DTNode, ABCAnalysis &ABC,
 
     // Remove the old check in the loop and the match the retain with a release.
     ArrayCall.removeCall();
+    ++NumBoundsChecksHoisted;
 
     LLVM_DEBUG(llvm::dbgs() << "  Bounds check hoisted\n");
     Changed = true;
@@ -140,26 +140,34 @@ namespace {
     //   F,F -> No
     //   F,T -> Yes
     //   T,F -> Partial
-    SmallBitVector Data;
+    // The two bits of an element live at the same index of two parallel
+    // bitvectors rather than adjacent to each other, so that the whole-set
+    // operations below work a word at a time instead of an element at a
+    // time; generated initializers of very large aggregates make these
+    // sets wide enough for that to matter.
+    SmallBitVector Bits1;
+    SmallBitVector Bits2;
   public:
     AvailabilitySet() {}
-  
+
     AvailabilitySet(unsigned NumElts) { init(NumElts); }
-    
+
     void init(unsigned NumElts) {
-      Data.set();
-      Data.resize(NumElts*2, true);
+      Bits1.set();
+      Bits1.resize(NumElts, true);
+      Bits2.set();
+      Bits2.resize(NumElts, true);
     }
 
-    bool empty() const { return Data.empty(); }
-    unsigned size() const { return Data.size()/2; }
+    bool empty() const { return Bits1.empty(); }
+    unsigned size() const { return Bits1.size(); }
 
     DIKind get(unsigned Elt) const {
       return getConditional(Elt).value();
     }
 
     std::optional<DIKind> getConditional(unsigned Elt) const {
-      bool V1 = Data[Elt*2], V2 = Data[Elt*2+1];
+      bool V1 = Bits1[Elt], V2 = Bits2[Elt];
       if (V1 == V2)
         return V1 ? std::optional<DIKind>(std::nullopt) : DIKind::No;
       return V2 ? DIKind::Yes : DIKind::Partial;
@@ -167,15 +175,15 @@ namespace {
 
     void set(unsigned Elt, DIKind K) {
       switch (K) {
-      case DIKind::No:      Data[Elt*2] = false; Data[Elt*2+1] = false; break;
-      case DIKind::Yes:     Data[Elt*2] = false, Data[Elt*2+1] = true; break;
-      case DIKind::Partial: Data[Elt*2] = true,  Data[Elt*2+1] = false; break;
+      case DIKind::No:      Bits1[Elt] = false; Bits2[Elt] = false; break;
+      case DIKind::Yes:     Bits1[Elt] = false, Bits2[Elt] = true; break;
+      case DIKind::Partial: Bits1[Elt] = true,  Bits2[Elt] = false; break;
       }
     }
 
     void set(unsigned Elt, std::optional<DIKind> K) {
       if (!K.has_value())
-        Data[Elt*2] = true, Data[Elt*2+1] = true;
+        Bits1[Elt] = true, Bits2[Elt] = true;
       else
         set(Elt, K.value());
     }
@@ -183,47 +191,120 @@ namespace {
     /// containsUnknownElements - Return true if there are any elements that are
     /// unknown.
     bool containsUnknownElements() const {
-      // Check that we didn't get any unknown values.
-      for (unsigned i = 0, e = size(); i != e; ++i)
-        if (!getConditional(i).has_value())
-          return true;
-      return false;
+      // Unknown elements have both bits set.
+      return Bits1.anyCommon(Bits2);
     }
 
     bool isAll(DIKind K) const {
-      for (unsigned i = 0, e = size(); i != e; ++i) {
-        auto Elt = getConditional(i);
-        if (!Elt.has_value() || Elt.value() != K)
-          return false;
+      switch (K) {
+      case DIKind::No:      return Bits1.none() && Bits2.none();
+      case DIKind::Yes:     return Bits1.none() && Bits2.all();
+      case DIKind::Partial: return Bits1.all() && Bits2.none();
       }
-      return true;
+      llvm_unreachable("covered switch");
     }
-    
+
     bool hasAny(DIKind K) const {
-      for (unsigned i = 0, e = size(); i != e; ++i) {
-        auto Elt = getConditional(i);
-        if (Elt.has_value() && Elt.value() == K)
-          return true;
+      switch (K) {
+      case DIKind::No: {
+        // No is the only encoding with both bits clear.
+        SmallBitVector AnySet = Bits1;
+        AnySet |= Bits2;
+        return !AnySet.all();
       }
-      return false;
+      case DIKind::Yes: {
+        SmallBitVector OnlyBit2 = Bits2;
+        OnlyBit2.reset(Bits1);
+        return OnlyBit2.any();
+      }
+      case DIKind::Partial: {
+        SmallBitVector OnlyBit1 = Bits1;
+        OnlyBit1.reset(Bits2);
+        return OnlyBit1.any();
+      }
+      }
+      llvm_unreachable("covered switch");
     }
-    
+
     bool isAllYes() const { return isAll(DIKind::Yes); }
     bool isAllNo() const { return isAll(DIKind::No); }
-    
+
     /// changeUnsetElementsTo - If any elements of this availability set are not
     /// known yet, switch them to the specified value.
     void changeUnsetElementsTo(DIKind K) {
-      for (unsigned i = 0, e = size(); i != e; ++i)
-        if (!getConditional(i).has_value())
-          set(i, K);
+      SmallBitVector Unknown = Bits1;
+      Unknown &= Bits2;
+      switch (K) {
+      case DIKind::No:
+        Bits1.reset(Unknown);
+        Bits2.reset(Unknown);
+        break;
+      case DIKind::Yes:
+        Bits1.reset(Unknown);
+        break;
+      case DIKind::Partial:
+        Bits2.reset(Unknown);
+        break;
+      }
     }
-    
+
     void mergeIn(const AvailabilitySet &RHS) {
       // Logically, this is an elementwise "this = merge(this, RHS)" operation,
-      // using the lattice merge operation for each element.
-      for (unsigned i = 0, e = size(); i != e; ++i)
-        set(i, mergeKinds(getConditional(i), RHS.getConditional(i)));
+      // using the lattice merge operation for each element:
+      //   - where this side is Unknown, take RHS;
+      //   - where RHS is Unknown, keep this side;
+      //   - where both sides are known and agree, keep the value;
+      //   - where both sides are known and disagree, the result is Partial.
+      SmallBitVector ThisUnknown = Bits1;
+      ThisUnknown &= Bits2;
+      SmallBitVector RHSUnknown = RHS.Bits1;
+      RHSUnknown &= RHS.Bits2;
+
+      // Elements where both sides are known but disagree merge to Partial.
+      SmallBitVector Differs1 = Bits1;
+      Differs1 ^= RHS.Bits1;
+      SmallBitVector Differs2 = Bits2;
+      Differs2 ^= RHS.Bits2;
+      Differs1 |= Differs2;
+      Differs1.reset(ThisUnknown);
+      Differs1.reset(RHSUnknown);
+
+      // Take RHS wherever this side is Unknown.
+      SmallBitVector Tmp = RHS.Bits1;
+      Tmp &= ThisUnknown;
+      Bits1.reset(ThisUnknown);
+      Bits1 |= Tmp;
+      Tmp = RHS.Bits2;
+      Tmp &= ThisUnknown;
+      Bits2.reset(ThisUnknown);
+      Bits2 |= Tmp;
+
+      // Force disagreeing known elements to Partial.
+      Bits1 |= Differs1;
+      Bits2.reset(Differs1);
+    }
+
+    /// Replace elements of this set with the corresponding element of RHS
+    /// wherever RHS has a known value.
+    void overrideKnownElements(const AvailabilitySet &RHS) {
+      SmallBitVector RHSKnown = RHS.Bits1;
+      RHSKnown &= RHS.Bits2;
+      RHSKnown.flip();
+      SmallBitVector Tmp = RHS.Bits1;
+      Tmp &= RHSKnown;
+      Bits1.reset(RHSKnown);
+      Bits1 |= Tmp;
+      Tmp = RHS.Bits2;
+      Tmp &= RHSKnown;
+      Bits2.reset(RHSKnown);
+      Bits2 |= Tmp;
+    }
+
+    bool operator==(const AvailabilitySet &RHS) const {
+      return Bits1 == RHS.Bits1 && Bits2 == RHS.Bits2;
+    }
+    bool operator!=(const AvailabilitySet &RHS) const {
+      return !(*this == RHS);
     }
 
     void dump(llvm::raw_ostream &OS) const {
@@ -331,15 +412,15 @@ namespace {
     /// Returns true if the live out set changed.
     bool mergeFromPred(const LiveOutBlockState &Pred) {
       bool changed = false;
-      for (unsigned i = 0, e = OutAvailability.size(); i != e; ++i) {
-        std::optional<DIKind> result;
-        if (transferAvailability(Pred.OutAvailability.getConditional(i),
-                                 OutAvailability.getConditional(i),
-                                 LocalAvailability.getConditional(i),
-                                 result)) {
-          changed = true;
-          OutAvailability.set(i, result);
-        }
+      // Apply the availability transfer function to all elements at once:
+      // local values override the incoming value, everything else merges the
+      // current live-out with the predecessor's live-out.
+      AvailabilitySet NewOut = OutAvailability;
+      NewOut.mergeIn(Pred.OutAvailability);
+      NewOut.overrideKnownElements(LocalAvailability);
+      if (NewOut != OutAvailability) {
+        changed = true;
+        OutAvailability = NewOut;
       }
 
       std::optional<DIKind> result;
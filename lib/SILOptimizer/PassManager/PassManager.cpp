@@ -51,6 +51,10 @@
 
 using namespace swift;
 
+STATISTIC(NumPassRunsSkipped,
+          "# of function pass runs skipped because the function was unchanged "
+          "since the pass last ran without making changes");
+
 llvm::cl::opt<bool> SILPrintAll(
     "sil-print-all", llvm::cl::init(false),
     llvm::cl::desc("Print SIL after each pass"));
@@ -632,6 +636,7 @@ void SILPassManager::runPassOnFunction(unsigned TransIdx, SILFunction *F) {
   if (!isMandatoryFunctionPass(SFT) &&
       completedPasses.test((size_t)SFT->getPassKind()) &&
       !SILDisableSkippingPasses) {
+    ++NumPassRunsSkipped;
     if (SILPrintPassName)
       dumpPassInfo("(Skip)", TransIdx, F);
     return;
@@ -784,6 +789,20 @@ runFunctionPasses(unsigned FromTransIdx, unsigned ToTransIdx) {
 
   assert(FunctionWorklist.empty() && "Expected empty function worklist!");
 
+  // Check whether any pass in this pipeline segment also runs for functions
+  // that are excluded from optimization. If none does, such functions can be
+  // left off the worklist entirely instead of being dispatched to — and
+  // rejected by — every pass in the segment.
+  bool anyMandatoryPasses = false;
+  for (unsigned Idx = FromTransIdx; Idx < ToTransIdx; ++Idx) {
+    if (auto *SFT = dyn_cast<SILFunctionTransform>(Transformations[Idx])) {
+      if (isMandatoryFunctionPass(SFT)) {
+        anyMandatoryPasses = true;
+        break;
+      }
+    }
+  }
+
   FunctionWorklist.reserve(BottomUpFunctions.size());
   for (auto I = BottomUpFunctions.rbegin(), E = BottomUpFunctions.rend();
        I != E; ++I) {
@@ -791,7 +810,7 @@ runFunctionPasses(unsigned FromTransIdx, unsigned ToTransIdx) {
 
     // Only include functions that are definitions, and which have not
     // been intentionally excluded from optimization.
-    if (F.isDefinition())
+    if (F.isDefinition() && (F.shouldOptimize() || anyMandatoryPasses))
       FunctionWorklist.push_back(*I);
   }
 
@@ -904,8 +923,11 @@ void SILPassManager::runModulePass(unsigned TransIdx) {
 
   updateSILModuleStatsAfterTransform(*Mod, SMT, *this, NumPassesRun, duration.count());
 
+  // Skip whole-module re-verification if the pass didn't invalidate anything,
+  // matching the policy for function passes above. Re-verifying every function
+  // after every module pass dominates -sil-verify-all build times.
   if (Options.VerifyAll &&
-      (CurrentPassHasInvalidated || !SILVerifyWithoutInvalidation)) {
+      (CurrentPassHasInvalidated || SILVerifyWithoutInvalidation)) {
     Mod->verify(getAnalysis<BasicCalleeAnalysis>()->getCalleeCache());
     verifyAnalyses();
     runSwiftModuleVerification();
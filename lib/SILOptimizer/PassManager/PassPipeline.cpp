@@ -899,6 +899,11 @@ static void addLastChanceOptPassPipeline(SILPassPipelinePlan &P) {
   // In optimized builds, do the inter-procedural analysis in a module pass.
   P.addStackProtection();
 
+  // Only has an effect if -emit-symbol-order-path is specified: write out a
+  // linker order file from the profile data now that the final set of
+  // functions is known.
+  P.addProfileGuidedSymbolOrdering();
+
   // FIXME: rdar://72935649 (Miscompile on combining PruneVTables with WMO)
   // P.addPruneVTables();
 }
@@ -48,6 +48,8 @@ using namespace swift;
 
 STATISTIC(NumCombined, "Number of instructions combined");
 STATISTIC(NumDeadInst, "Number of dead insts eliminated");
+STATISTIC(NumRevisitedBlocks,
+          "Number of blocks revisited in re-seeded iterations");
 
 static llvm::cl::opt<bool> EnableSinkingOwnedForwardingInstToUses(
     "silcombine-owned-code-sinking",
@@ -115,6 +117,33 @@ void SILCombiner::addReachableCodeToWorklist(SILBasicBlock *BB) {
   addInitialGroup(InstrsForSILCombineWorklist);
 }
 
+/// Re-seed the worklist after a fixpoint iteration that made changes. Only
+/// instructions in blocks that saw additions, deletions or replacements can
+/// have become combinable since the last iteration, so visit just those
+/// blocks instead of rescanning the whole function. Walking the CFG from the
+/// entry block also filters out changed blocks that have since become
+/// unreachable.
+void SILCombiner::addChangedCodeToWorklist(SILBasicBlock *BB) {
+  BasicBlockWorklist Worklist(BB);
+  llvm::SmallVector<SILInstruction *, 128> InstrsForSILCombineWorklist;
+
+  while (SILBasicBlock *BB = Worklist.pop()) {
+    if (ChangedBlocks.count(BB)) {
+      ++NumRevisitedBlocks;
+      for (SILInstruction &Inst : *BB) {
+        InstrsForSILCombineWorklist.push_back(&Inst);
+      }
+    }
+
+    for (SILBasicBlock *Succ : BB->getSuccessors()) {
+      Worklist.pushIfNotVisited(Succ);
+    }
+  }
+
+  ChangedBlocks.clear();
+  addInitialGroup(InstrsForSILCombineWorklist);
+}
+
 //===----------------------------------------------------------------------===//
 //                               Implementation
 //===----------------------------------------------------------------------===//
@@ -393,8 +422,16 @@ bool SILCombiner::doOneIteration(SILFunction &F, unsigned Iteration) {
   LLVM_DEBUG(llvm::dbgs() << "\n\nSILCOMBINE ITERATION #" << Iteration << " on "
                           << F.getName() << "\n");
 
-  // Add reachable instructions to our worklist.
-  addReachableCodeToWorklist(&*F.begin());
+  // Add reachable instructions to our worklist. The first iteration scans
+  // the whole function; later iterations only revisit the blocks that
+  // changed during the previous one, which the worklist records for us as
+  // instructions are (re-)added in reaction to changes.
+  if (Iteration == 0) {
+    addReachableCodeToWorklist(&*F.begin());
+    Worklist.setChangedBlockCollector(&ChangedBlocks);
+  } else {
+    addChangedCodeToWorklist(&*F.begin());
+  }
 
   SILCombineCanonicalize scCanonicalize(Worklist, deadEndBlocks);
 
@@ -41,6 +41,7 @@
 #include "swift/SILOptimizer/Utils/OwnershipOptUtils.h"
 
 #include "llvm/ADT/DenseMap.h"
+#include "llvm/ADT/SmallPtrSet.h"
 #include "llvm/ADT/SmallVector.h"
 
 namespace swift {
@@ -88,6 +89,11 @@ private:
   /// Variable to track if the SILCombiner made any changes.
   bool MadeChange;
 
+  /// The blocks that contained changes during the current fixpoint
+  /// iteration. Subsequent iterations re-seed the worklist from these
+  /// blocks only, instead of rescanning the whole function.
+  llvm::SmallPtrSet<SILBasicBlock *, 32> ChangedBlocks;
+
   /// If set to true then the optimizer is free to erase cond_fail instructions.
   bool RemoveCondFails;
 
@@ -134,6 +140,8 @@ public:
   void clear() {
     Iteration = 0;
     Worklist.resetChecked();
+    Worklist.setChangedBlockCollector(nullptr);
+    ChangedBlocks.clear();
     MadeChange = false;
   }
 
@@ -421,6 +429,10 @@ private:
   /// process a new function.
   void addReachableCodeToWorklist(SILBasicBlock *BB);
 
+  /// Add the reachable code in blocks that changed during the previous
+  /// fixpoint iteration to the worklist.
+  void addChangedCodeToWorklist(SILBasicBlock *BB);
+
   typedef SmallVector<SILInstruction*, 4> UserListTy;
 
   /// Returns a list of instructions that project or perform reference
@@ -91,6 +91,11 @@
 #include "swift/SILOptimizer/Utils/OwnershipOptUtils.h"
 #include "llvm/ADT/MapVector.h"
 #include "llvm/ADT/SCCIterator.h"
+#include "llvm/ADT/Statistic.h"
+
+STATISTIC(NumLocalAccessesConverted,
+          "Number of local accesses converted to static enforcement");
+STATISTIC(NumAccessScopesMerged, "Number of access scopes merged");
 
 using namespace swift;
 
@@ -913,6 +918,7 @@ removeLocalNonNestedAccess(const AccessConflictAndMergeAnalysis::Result &result,
     if (functionAccess.hasNoNestedConflict(info)) {
       LLVM_DEBUG(llvm::dbgs() << "Disabling dead access " << *beginAccess);
       beginAccess->setEnforcement(SILAccessEnforcement::Static);
+      ++NumLocalAccessesConverted;
       changed = true;
     }
   }
@@ -1101,6 +1107,7 @@ mergeAccesses(SILFunction *F, PostDominanceInfo *postDomTree,
     // Modify the users of child instruction to use the parent:
     childIns->replaceAllUsesWith(parentIns);
 
+    ++NumAccessScopesMerged;
     changed = true;
   }
 
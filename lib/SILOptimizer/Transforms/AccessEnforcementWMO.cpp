@@ -61,6 +61,10 @@
 #include "swift/SIL/SILFunction.h"
 #include "swift/SILOptimizer/PassManager/Transforms.h"
 #include "swift/SILOptimizer/Utils/InstOptUtils.h"
+#include "llvm/ADT/Statistic.h"
+
+STATISTIC(NumDisjointAccessesConverted,
+          "Number of disjoint accesses converted to static enforcement");
 
 using namespace swift;
 
@@ -303,6 +307,7 @@ void GlobalAccessRemoval::removeNonreentrantAccess() {
     for (BeginAccessInst *beginAccess : info.beginAccessSet) {
       LLVM_DEBUG(llvm::dbgs() << "  Disabling access marker " << *beginAccess);
       beginAccess->setEnforcement(SILAccessEnforcement::Static);
+      ++NumDisjointAccessesConverted;
       changedFunctions.insert(beginAccess->getFunction());
     }
   }
@@ -451,6 +451,16 @@ bool isProfitableToInlineAutodiffVJP(SILFunction *vjp, SILFunction *caller,
   return true;
 }
 
+// The cost/benefit walk below is deliberately call-site-sensitive: the
+// ConstantTracker is seeded with the caller's constants at this apply, and
+// most of the benefit comes from closures, devirtualization, and generic
+// specializations that only materialize for this particular call. That is
+// why a context-free per-function summary (serialized instruction counts
+// and loop depths) cannot replace it - the summary would miss exactly the
+// opportunities that make inlining profitable. Callee bodies are not
+// deserialized here either way: external declarations are rejected by
+// getEligibleFunction, and cross-module bodies arrive via the SIL linker
+// only for functions marked available for inlining.
 bool SILPerformanceInliner::isProfitableToInline(
     FullApplySite AI, Weight CallerWeight, ConstantTracker &callerTracker,
     int &NumCallerBlocks,
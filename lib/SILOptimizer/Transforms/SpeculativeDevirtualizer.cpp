@@ -601,6 +601,13 @@ namespace {
       if (CurFn.optimizeForSize())
         return;
 
+      // When profile data is available, don't speculate in functions the
+      // profiling run never executed: the guarded direct calls only add code
+      // size at sites where no time is spent.
+      if (auto entryCount = CurFn.getEntryCount())
+        if (entryCount.getValue() == 0)
+          return;
+
       // Don't speculatively devirtualize calls inside thunks.
       if (CurFn.isThunk())
         return;
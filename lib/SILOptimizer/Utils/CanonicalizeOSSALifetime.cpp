@@ -266,22 +266,33 @@ void CanonicalizeOSSALifetime::extendLivenessToDeinitBarriers() {
 
   // OSSALifetimeCompletion: With complete lifetimes, creating completeLiveness
   // and using it to visiti unreachable lifetime ends should be deleted.
-  SmallVector<SILBasicBlock *, 32> discoveredBlocks(this->discoveredBlocks);
-  SSAPrunedLiveness completeLiveness(*liveness, &discoveredBlocks);
+  //
+  // Lifetimes can only end at unreachables if the function has dead-end
+  // blocks, and dead-end blocks always end in an unreachable. Scanning the
+  // terminators is much cheaper than copying the liveness map and running the
+  // availability dataflow for every canonicalized def.
+  auto hasDeadEnds =
+      llvm::any_of(*getCurrentDef()->getFunction(), [](auto &block) {
+        return isa<UnreachableInst>(block.getTerminator());
+      });
+  if (hasDeadEnds) {
+    SmallVector<SILBasicBlock *, 32> discoveredBlocks(this->discoveredBlocks);
+    SSAPrunedLiveness completeLiveness(*liveness, &discoveredBlocks);
 
-  for (auto *end : outsideDestroys) {
-    completeLiveness.updateForUse(end, /*lifetimeEnding*/ true);
-  }
+    for (auto *end : outsideDestroys) {
+      completeLiveness.updateForUse(end, /*lifetimeEnding*/ true);
+    }
 
-  OSSALifetimeCompletion::visitUnreachableLifetimeEnds(
-      getCurrentDef(), OSSALifetimeCompletion::DoNotAllowLeaks,
-      completeLiveness, [&](auto *unreachable) {
-        recordUnreachableLifetimeEnd(unreachable);
-        unreachable->visitPriorInstructions([&](auto *inst) {
-          liveness->extendToNonUse(inst);
-          return true;
+    OSSALifetimeCompletion::visitUnreachableLifetimeEnds(
+        getCurrentDef(), OSSALifetimeCompletion::DoNotAllowLeaks,
+        completeLiveness, [&](auto *unreachable) {
+          recordUnreachableLifetimeEnd(unreachable);
+          unreachable->visitPriorInstructions([&](auto *inst) {
+            liveness->extendToNonUse(inst);
+            return true;
+          });
         });
-      });
+  }
 
   auto *def = getCurrentDef()->getDefiningInstruction();
   using InitialBlocks = ArrayRef<SILBasicBlock *>;
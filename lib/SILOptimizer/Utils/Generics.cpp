@@ -39,6 +39,9 @@ using namespace swift;
 STATISTIC(NumPreventedGenericSpecializationLoops,
           "# of prevented infinite generic specializations loops");
 
+STATISTIC(NumReusedSpecializations,
+          "# of specializations reused instead of re-created");
+STATISTIC(NumCreatedSpecializations, "# of specializations created");
 STATISTIC(NumPreventedTooComplexGenericSpecializations,
           "# of prevented generic specializations with too complex "
           "generic type parameters");
@@ -2028,6 +2031,7 @@ SILFunction *GenericFuncSpecializer::lookupSpecialization() {
            "Previously specialized function does not match expected type.");
     LLVM_DEBUG(llvm::dbgs() << "Found an existing specialization for: "
                             << ClonedName << "\n");
+    ++NumReusedSpecializations;
     return SpecializedF;
   }
   LLVM_DEBUG(llvm::dbgs() << "Could not find an existing specialization for: "
@@ -2051,6 +2055,7 @@ GenericFuncSpecializer::tryCreateSpecialization(bool forcePrespecialization) {
 
   LLVM_DEBUG(llvm::dbgs() << "Creating a specialization: "
                           << ClonedName << "\n");
+  ++NumCreatedSpecializations;
 
   ReInfo.verify();
 
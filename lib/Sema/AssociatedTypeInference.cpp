@@ -62,6 +62,10 @@ STATISTIC(NumConstrainedExtensionChecksFailed,
           "# of constrained extension checks failed");
 STATISTIC(NumDuplicateSolutionStates,
           "# of duplicate solution states ");
+STATISTIC(NumValueWitnessesExamined,
+          "# of value witness candidates examined");
+STATISTIC(NumValueWitnessesPrunedStructurally,
+          "# of value witness candidates pruned by structural filters");
 
 using namespace swift;
 
@@ -1563,6 +1567,47 @@ static void tryOptimizeDisjunction(InferredAssociatedTypesByWitnesses &result) {
   result.resize(1);
 }
 
+/// Cheap structural checks, mirroring the early rejections in matchWitness(),
+/// that rule a candidate out before we pay for interface type computation,
+/// substitution and structural type matching. Anything rejected here would
+/// also be rejected by matchWitness(), just later and at a higher cost.
+static bool isStructurallyViableWitness(ValueDecl *req, ValueDecl *witness) {
+  // The witness must be of the same kind as the requirement, except that an
+  // enum element can witness a static property or function requirement.
+  if (req->getKind() != witness->getKind()) {
+    return (isa<VarDecl>(req) || isa<FuncDecl>(req)) &&
+           isa<EnumElementDecl>(witness);
+  }
+
+  if (auto *funcReq = dyn_cast<FuncDecl>(req)) {
+    auto *funcWitness = cast<FuncDecl>(witness);
+
+    // Either both must be 'static' or neither, except that an operator
+    // requirement can be witnessed at module scope.
+    if (funcReq->isStatic() != funcWitness->isStatic() &&
+        !(funcReq->isOperator() &&
+          !funcWitness->getDeclContext()->isTypeContext()))
+      return false;
+
+    // Matching never succeeds with a different number of parameters.
+    if (funcReq->getParameters()->size() !=
+        funcWitness->getParameters()->size())
+      return false;
+
+    // A non-mutating requirement cannot be witnessed by a mutating function.
+    if (!funcReq->isMutating() && funcWitness->isMutating())
+      return false;
+  } else if (auto *reqASD = dyn_cast<AbstractStorageDecl>(req)) {
+    auto *witnessASD = cast<AbstractStorageDecl>(witness);
+
+    // Either both must be 'static' or neither.
+    if (reqASD->isStatic() != witnessASD->isStatic())
+      return false;
+  }
+
+  return true;
+}
+
 /// Create an initial constraint system for the associated type inference solver.
 ///
 /// Each protocol requirement defines a disjunction, where each disjunction
@@ -1615,6 +1660,19 @@ AssociatedTypeInference::getPotentialTypeWitnessesFromRequirement(
     LLVM_DEBUG(llvm::dbgs() << "Inferring associated types from decl:\n";
                witness->dump(llvm::dbgs()));
 
+    ++NumValueWitnessesExamined;
+
+    // Prune candidates that matchWitness() is guaranteed to reject before
+    // doing any expensive type matching. A rejected witness contributes no
+    // bindings, which is the same as a tautological one as far as the
+    // solver is concerned.
+    if (!isStructurallyViableWitness(req, witness)) {
+      LLVM_DEBUG(llvm::dbgs() << "-- structurally non-viable\n");
+      ++NumValueWitnessesPrunedStructurally;
+      hadTautologicalWitness = true;
+      continue;
+    }
+
     // This is the protocol `Self` type if the witness is declared in a protocol
     // extension, or nullptr.
     Type selfTy;
@@ -1171,10 +1171,49 @@ ConstraintSystem::matchResultBuilder(AnyFunctionRef fn, Type builderType,
     return std::nullopt;
   }
 
+  auto diagnoseUnsupported =
+      [&](SkipUnhandledConstructInResultBuilder::UnhandledNode unsupported)
+      -> TypeMatchResult {
+    // If we aren't supposed to attempt fixes, fail.
+    if (!shouldAttemptFixes()) {
+      return getTypeMatchFailure(locator);
+    }
+
+    // If we're solving for code completion and the body contains the code
+    // completion location, skipping it won't get us to a useful solution so
+    // just bail.
+    if (isForCodeCompletion() &&
+        containsIDEInspectionTarget(fn.getBody())) {
+      return getTypeMatchFailure(locator);
+    }
+
+    // Record the first unhandled construct as a fix.
+    if (recordFix(
+            SkipUnhandledConstructInResultBuilder::create(
+                *this, unsupported, builder, getConstraintLocator(locator)),
+            /*impact=*/100)) {
+      return getTypeMatchFailure(locator);
+    }
+
+    if (auto *closure =
+            getAsExpr<ClosureExpr>(fn.getAbstractClosureExpr())) {
+      recordTypeVariablesAsHoles(getClosureType(closure));
+    }
+
+    return getTypeMatchSuccess();
+  };
+
   auto transformedBody = getBuilderTransformedBody(fn, builder);
   // If this builder transform has not yet been applied to this function,
   // let's do it and cache the result.
   if (!transformedBody) {
+    // If a previous attempt along a different solver path already determined
+    // that this body contains a construct the transform cannot handle, don't
+    // re-run the transform just to rediscover it.
+    auto knownUnsupported = UnsupportedBuilderBodies.find({fn, builder});
+    if (knownUnsupported != UnsupportedBuilderBodies.end())
+      return diagnoseUnsupported(knownUnsupported->second);
+
     ResultBuilderTransform transform(*this, fn.getAsDeclContext(),
                                      builderType, bodyResultType);
     auto *body = transform.apply(fn.getBody());
@@ -1182,33 +1221,8 @@ ConstraintSystem::matchResultBuilder(AnyFunctionRef fn, Type builderType,
     if (auto unsupported = transform.getUnsupportedElement()) {
       assert(!body || getASTContext().CompletionCallback);
 
-      // If we aren't supposed to attempt fixes, fail.
-      if (!shouldAttemptFixes()) {
-        return getTypeMatchFailure(locator);
-      }
-
-      // If we're solving for code completion and the body contains the code
-      // completion location, skipping it won't get us to a useful solution so
-      // just bail.
-      if (isForCodeCompletion() &&
-          containsIDEInspectionTarget(fn.getBody())) {
-        return getTypeMatchFailure(locator);
-      }
-
-      // Record the first unhandled construct as a fix.
-      if (recordFix(
-              SkipUnhandledConstructInResultBuilder::create(
-                  *this, unsupported, builder, getConstraintLocator(locator)),
-              /*impact=*/100)) {
-        return getTypeMatchFailure(locator);
-      }
-
-      if (auto *closure =
-              getAsExpr<ClosureExpr>(fn.getAbstractClosureExpr())) {
-        recordTypeVariablesAsHoles(getClosureType(closure));
-      }
-
-      return getTypeMatchSuccess();
+      UnsupportedBuilderBodies.insert({{fn, builder}, unsupported});
+      return diagnoseUnsupported(unsupported);
     }
 
     transformedBody = std::make_pair(transform.getBuilderSelf(), body);
@@ -7859,6 +7859,41 @@ Expr *ExprRewriter::convertLiteralInPlace(
   // Check whether this literal type conforms to the builtin protocol. If so,
   // initialize via the builtin protocol.
   if (builtinProtocol) {
+    // The common case is a literal of a default standard library type; use
+    // the builtin initializer witness cached on the ASTContext rather than
+    // repeating the conformance and witness lookup for every literal.
+    ConcreteDeclRef cachedWitness;
+    if (auto builtinKind = builtinProtocol->getKnownProtocolKind()) {
+      auto &ctx = cs.getASTContext();
+      auto *nominal = type->getAnyNominal();
+      switch (*builtinKind) {
+      case KnownProtocolKind::ExpressibleByBuiltinBooleanLiteral:
+        if (nominal && nominal == ctx.getBoolDecl())
+          cachedWitness = ctx.getBoolBuiltinInitDecl();
+        break;
+      case KnownProtocolKind::ExpressibleByBuiltinIntegerLiteral:
+        if (nominal && nominal == ctx.getIntDecl())
+          cachedWitness = ctx.getIntBuiltinInitDecl(nominal);
+        break;
+      case KnownProtocolKind::ExpressibleByBuiltinFloatLiteral:
+        if (nominal &&
+            (nominal == ctx.getFloatDecl() || nominal == ctx.getDoubleDecl()))
+          cachedWitness = ctx.getFloatBuiltinInitDecl(nominal);
+        break;
+      case KnownProtocolKind::ExpressibleByBuiltinStringLiteral:
+        if (nominal && nominal == ctx.getStringDecl())
+          cachedWitness = ctx.getStringBuiltinInitDecl(nominal);
+        break;
+      default:
+        break;
+      }
+    }
+    if (cachedWitness && isa<AbstractFunctionDecl>(cachedWitness.getDecl())) {
+      cast<BuiltinLiteralExpr>(literal)->setBuiltinInitializer(cachedWitness);
+      cs.setType(literal, type);
+      return literal;
+    }
+
     auto builtinConformance = dc->getParentModule()->checkConformance(
         type, builtinProtocol);
     if (builtinConformance) {
@@ -989,8 +989,11 @@ BindingSet::BindingScore BindingSet::formBindingScore(const BindingSet &b) {
 
 std::optional<BindingSet> ConstraintSystem::determineBestBindings(
     llvm::function_ref<void(const BindingSet &)> onCandidate) {
-  // Look for potential type variable bindings.
-  std::optional<BindingSet> bestBindings;
+  // Look for potential type variable bindings. The best set is tracked by
+  // pointer into the cache: entries are only read and updated in place during
+  // finalization, never inserted, so the pointer stays valid and copying a
+  // candidate set per improvement is unnecessary.
+  BindingSet *bestBindings = nullptr;
   llvm::SmallDenseMap<TypeVariableType *, BindingSet> cache;
 
   // First, let's collect all of the possible bindings.
@@ -1062,10 +1065,13 @@ std::optional<BindingSet> ConstraintSystem::determineBestBindings(
     // If these are the first bindings, or they are better than what
     // we saw before, use them instead.
     if (!bestBindings || bindings < *bestBindings)
-      bestBindings.emplace(bindings);
+      bestBindings = &bindings;
   }
 
-  return bestBindings;
+  if (!bestBindings)
+    return std::nullopt;
+
+  return *bestBindings;
 }
 
 /// Find the set of type variables that are inferable from the given type.
@@ -46,6 +46,53 @@ static bool isArithmeticOperatorDecl(ValueDecl *vd) {
   return vd && vd->getBaseIdentifier().isArithmeticOperator();
 }
 
+namespace {
+/// The shape shared by every standard-library overload of an operator on
+/// the concrete numeric and string types.
+enum class StandardOperatorShape {
+  /// (T, T) -> T, e.g. arithmetic, bitwise and shift operators.
+  Homogeneous,
+  /// (T, T) -> Bool, e.g. comparison operators.
+  Comparison,
+};
+
+struct StandardOperatorEntry {
+  const char *Spelling;
+  StandardOperatorShape Shape;
+};
+
+/// Compile-time table of standard-library operators with a known overload
+/// shape. When both operands of one of these operators already have the
+/// same concrete type, the overload taking exactly that type can be favored
+/// without consulting the contextual-type machinery for every candidate.
+constexpr StandardOperatorEntry StandardOperatorTable[] = {
+    {"+", StandardOperatorShape::Homogeneous},
+    {"-", StandardOperatorShape::Homogeneous},
+    {"*", StandardOperatorShape::Homogeneous},
+    {"/", StandardOperatorShape::Homogeneous},
+    {"%", StandardOperatorShape::Homogeneous},
+    {"&", StandardOperatorShape::Homogeneous},
+    {"|", StandardOperatorShape::Homogeneous},
+    {"^", StandardOperatorShape::Homogeneous},
+    {"<<", StandardOperatorShape::Homogeneous},
+    {">>", StandardOperatorShape::Homogeneous},
+    {"==", StandardOperatorShape::Comparison},
+    {"!=", StandardOperatorShape::Comparison},
+    {"<", StandardOperatorShape::Comparison},
+    {">", StandardOperatorShape::Comparison},
+    {"<=", StandardOperatorShape::Comparison},
+    {">=", StandardOperatorShape::Comparison},
+};
+} // end anonymous namespace
+
+static std::optional<StandardOperatorShape>
+getStandardOperatorShape(Identifier name) {
+  for (const auto &entry : StandardOperatorTable)
+    if (name.is(entry.Spelling))
+      return entry.Shape;
+  return std::nullopt;
+}
+
 static bool mergeRepresentativeEquivalenceClasses(ConstraintSystem &CS,
                                                   TypeVariableType* tyvar1,
                                                   TypeVariableType* tyvar2) {
@@ -747,6 +794,33 @@ namespace {
 
       auto contextualTy = CS.getContextualType(expr, /*forConstraint=*/false);
 
+      // Fast path driven by the standard-operator table: when both operands
+      // already share a concrete type and this overload takes exactly that
+      // type with the result the operator's shape dictates, it is the one
+      // the solver would pick anyway; accept it without running the general
+      // checks below. Mismatches simply fall through.
+      if (auto opShape = getStandardOperatorShape(value->getBaseIdentifier())) {
+        if (firstArgTy->isEqual(secondArgTy) &&
+            !firstArgTy->hasTypeVariable() &&
+            !firstArgTy->hasUnresolvedType() &&
+            firstParamTy->isEqual(firstArgTy) &&
+            secondParamTy->isEqual(firstArgTy)) {
+          auto resultTy = fnTy->getResult();
+          switch (*opShape) {
+          case StandardOperatorShape::Homogeneous:
+            if (resultTy->isEqual(firstArgTy) &&
+                (!contextualTy || contextualTy->isEqual(resultTy)))
+              return true;
+            break;
+          case StandardOperatorShape::Comparison:
+            if (resultTy->isBool() &&
+                (!contextualTy || contextualTy->isBool()))
+              return true;
+            break;
+          }
+        }
+      }
+
       // Avoid favoring overloads that would require narrowing conversion
       // to match the arguments.
       {
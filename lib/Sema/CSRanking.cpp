@@ -31,6 +31,8 @@ using namespace constraints;
 //===----------------------------------------------------------------------===//
 #define DEBUG_TYPE "Constraint solver overall"
 STATISTIC(NumDiscardedSolutions, "Number of solutions discarded");
+STATISTIC(NumPrunedBranches,
+          "Number of branches pruned as worse than the best solution");
 
 /// Returns \c true if \p expr takes a code completion expression as an
 /// argument.
@@ -145,6 +147,8 @@ bool ConstraintSystem::worseThanBestSolution() const {
       CurrentScore <= *solverState->BestScore)
     return false;
 
+  ++NumPrunedBranches;
+
   if (isDebugMode()) {
     llvm::errs().indent(solverState->getCurrentIndent())
         << "(solution is worse than the best solution)\n";
@@ -19,6 +19,7 @@
 #include "swift/AST/ParameterList.h"
 #include "swift/AST/TypeWalker.h"
 #include "swift/Basic/Defer.h"
+#include "swift/Basic/Statistic.h"
 #include "swift/Sema/ConstraintGraph.h"
 #include "swift/Sema/ConstraintSystem.h"
 #include "swift/Sema/SolutionResult.h"
@@ -97,6 +98,21 @@ Solution ConstraintSystem::finalize() {
     }
   }
 
+  // The solution's tables are rebuilt entry-by-entry from the solver's
+  // state below; size them up front so forming a solution doesn't pay for
+  // repeated rehashing, which shows up as an allocation hot spot when many
+  // solutions are formed for expression-heavy code.
+  solution.typeBindings.reserve(getTypeVariables().size());
+  solution.overloadChoices.reserve(ResolvedOverloads.size());
+  solution.ConstraintRestrictions.reserve(ConstraintRestrictions.size());
+  solution.DisjunctionChoices.reserve(DisjunctionChoices.size());
+  solution.OpenedTypes.reserve(OpenedTypes.size());
+  solution.OpenedExistentialTypes.reserve(OpenedExistentialTypes.size());
+  solution.OpenedPackExpansionTypes.reserve(OpenedPackExpansionTypes.size());
+  solution.DefaultedConstraints.reserve(DefaultedConstraints.size());
+  solution.nodeTypes.reserve(NodeTypes.size());
+  solution.keyPathComponentTypes.reserve(KeyPathComponentTypes.size());
+
   // For each of the type variables, get its fixed type.
   for (auto tv : getTypeVariables()) {
     // This type variable has no binding. Allowed only
@@ -132,6 +148,7 @@ Solution ConstraintSystem::finalize() {
     firstFixIndex = solverState->PartialSolutionScope->numFixes;
   }
 
+  solution.Fixes.reserve(Fixes.size() - firstFixIndex);
   for (const auto &fix :
        llvm::make_range(Fixes.begin() + firstFixIndex, Fixes.end()))
     solution.Fixes.push_back(fix);
@@ -1585,6 +1602,34 @@ ConstraintSystem::solve(SyntacticElementTarget &target,
   llvm_unreachable("Loop always returns");
 }
 
+/// Hash the structural shape of a single constraint: its kind, the shapes
+/// of any nested constraints, and the path element kinds of its locator.
+static llvm::hash_code hashConstraintShape(const Constraint &constraint) {
+  llvm::hash_code hash =
+      llvm::hash_value(static_cast<unsigned>(constraint.getKind()));
+
+  if (constraint.getKind() == ConstraintKind::Disjunction ||
+      constraint.getKind() == ConstraintKind::Conjunction) {
+    for (auto *nested : constraint.getNestedConstraints())
+      hash = llvm::hash_combine(hash, hashConstraintShape(*nested));
+    return hash;
+  }
+
+  if (auto *locator = constraint.getLocator()) {
+    for (const auto &elt : locator->getPath())
+      hash = llvm::hash_combine(hash, static_cast<unsigned>(elt.getKind()));
+  }
+
+  return hash;
+}
+
+uint64_t ConstraintSystem::getConstraintShapeDigest() const {
+  auto digest = llvm::hash_value(InactiveConstraints.size());
+  for (const auto &constraint : InactiveConstraints)
+    digest = llvm::hash_combine(digest, hashConstraintShape(constraint));
+  return digest;
+}
+
 SolutionResult
 ConstraintSystem::solveImpl(SyntacticElementTarget &target,
                             FreeTypeVariableBinding allowFreeTypeVariables) {
@@ -1609,6 +1654,14 @@ ConstraintSystem::solveImpl(SyntacticElementTarget &target,
   if (generateConstraints(target, allowFreeTypeVariables))
     return SolutionResult::forError();;
 
+  // Record the shape of the generated system; duplicate shapes measure how
+  // much re-solving a shape-keyed solution cache could avoid.
+  if (auto *stats = getASTContext().Stats) {
+    auto &digests = getASTContext().SolvedConstraintSystemDigests;
+    if (!digests.insert(getConstraintShapeDigest()).second)
+      ++stats->getFrontendCounters().NumDuplicateConstraintSystemShapes;
+  }
+
   // Try to solve the constraint system using computed suggestions.
   SmallVector<Solution, 4> solutions;
   solve(solutions, allowFreeTypeVariables);
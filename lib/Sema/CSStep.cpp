@@ -125,16 +125,20 @@ void SplitterStep::computeFollowupSteps(
       new SmallVector<Solution, 4>[numComponents]);
 
   // Add components.
+  bool anyDependent = false;
+  SmallVector<unsigned, 4> stepDisjunctions;
   for (unsigned i : indices(components)) {
     unsigned solutionIndex = components[i].solutionIndex;
 
     // If there are no dependencies, build a normal component step.
     if (components[i].getDependencies().empty()) {
+      stepDisjunctions.push_back(components[i].getNumDisjunctions());
       steps.push_back(std::make_unique<ComponentStep>(
           CS, solutionIndex, &Components[i], std::move(components[i]),
           PartialSolutions[solutionIndex]));
       continue;
     }
+    anyDependent = true;
 
     // Note that the partial results from any dependencies of this component
     // need not be included in the final merged results, because they'll
@@ -150,6 +154,28 @@ void SplitterStep::computeFollowupSteps(
         llvm::MutableArrayRef(PartialSolutions.get(), numComponents)));
   }
 
+  // Attempt the components with the fewest disjunctions first; if a
+  // cheap component fails there is no need to explore the disjunction
+  // choices of its more expensive siblings at all. The solver work list
+  // is a stack, so a step that should run earlier has to be placed
+  // later in the list. This is only safe when components don't have
+  // one-way dependencies between them, because dependent splitter steps
+  // rely on the order computed by the connected components algorithm.
+  if (!anyDependent && steps.size() > 1) {
+    SmallVector<unsigned, 4> order(indices(steps).begin(),
+                                   indices(steps).end());
+    std::stable_sort(order.begin(), order.end(), [&](unsigned lhs,
+                                                     unsigned rhs) {
+      return stepDisjunctions[lhs] > stepDisjunctions[rhs];
+    });
+
+    SmallVector<std::unique_ptr<SolverStep>, 4> reordered;
+    reordered.reserve(steps.size());
+    for (unsigned index : order)
+      reordered.push_back(std::move(steps[index]));
+    steps = std::move(reordered);
+  }
+
   assert(CS.InactiveConstraints.empty() && "Missed a constraint");
 }
 
@@ -832,6 +832,10 @@ namespace {
                         ArrayRef<TypeVariableType *> typeVars)
         : cg(cg), typeVars(typeVars)
     {
+      // Almost every type variable ends up with an entry; sizing the map up
+      // front avoids rehashing during the depth-first searches below.
+      representatives.reserve(typeVars.size());
+
       auto oneWayConstraints = connectedComponents();
 
       // If there were no one-way constraints, we're done.
@@ -986,16 +990,27 @@ namespace {
     /// Find the representative for the given type variable within the set
     /// of representatives in a union-find data structure.
     TypeVariableType *findRepresentative(TypeVariableType *typeVar) const {
-      // If we don't have a record of this type variable, it is it's own
-      // representative.
-      auto known = representatives.find(typeVar);
-      if (known == representatives.end() || known->second == typeVar)
-        return typeVar;
-
-      // Find the representative of the parent.
-      auto parent = known->second;
-      auto rep = findRepresentative(parent);
-      representatives[typeVar] = rep;
+      // If we don't have a record of a type variable, it is its own
+      // representative. Walk to the root of the chain.
+      auto rep = typeVar;
+      while (true) {
+        auto known = representatives.find(rep);
+        if (known == representatives.end() || known->second == rep)
+          break;
+        rep = known->second;
+      }
+
+      // Path compression: repoint everything on the chain we just walked
+      // directly at the root, so subsequent finds are a single probe. This is
+      // called for every type variable of every constraint each time the
+      // solver splits, so it needs to stay cheap and can't recurse on long
+      // chains.
+      while (typeVar != rep) {
+        auto known = representatives.find(typeVar);
+        auto parent = known->second;
+        known->second = rep;
+        typeVar = parent;
+      }
 
       return rep;
     }
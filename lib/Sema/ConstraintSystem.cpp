@@ -130,6 +130,17 @@ ConstraintSystem::ConstraintSystem(DeclContext *dc,
 }
 
 ConstraintSystem::~ConstraintSystem() {
+  // Record how much memory this constraint system retained over its
+  // lifetime. Both the constraint arena and the ASTContext's solver arena
+  // are torn down with the system, so this is the high-water mark for a
+  // single typechecked expression.
+  if (auto *Stats = getASTContext().Stats) {
+    Stats->getFrontendCounters().ConstraintSolverAllocatedBytes +=
+        Allocator.getBytesAllocated();
+    Stats->getFrontendCounters().ConstraintSolverArenaBytes +=
+        getASTContext().getSolverMemory();
+  }
+
   delete &CG;
 }
 
@@ -298,7 +298,14 @@ void swift::performImportResolution(SourceFile &SF) {
   SF.setImportedUnderlyingModule(resolver.getUnderlyingClangModule());
 
   SF.ASTStage = SourceFile::ImportsResolved;
-  verify(SF);
+
+  // Primary files are verified again once they are fully type checked, and
+  // that walk re-checks all of the parse-stage invariants on every node, so
+  // verifying here would just walk the whole AST twice. Secondary files only
+  // have their imports resolved, making this their one chance at
+  // verification.
+  if (!SF.isPrimary())
+    verify(SF);
 }
 
 //===----------------------------------------------------------------------===//
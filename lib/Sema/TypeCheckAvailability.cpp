@@ -582,6 +582,14 @@ private:
       return true;
     }
 
+    // Nominal type members only need refinement contexts when availability
+    // queries land inside the type's body, so don't pay for walking every
+    // member up front. This keeps the initial hierarchy for a file shallow;
+    // queries expand the subtrees along their own path to the root.
+    if (isa<NominalTypeDecl>(D)) {
+      return true;
+    }
+
     return false;
   }
 
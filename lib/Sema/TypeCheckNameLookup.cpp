@@ -549,6 +549,16 @@ unsigned TypeChecker::getCallEditDistance(DeclNameRef writtenName,
     return UnreasonableCallEditDistance;
   }
 
+  // The edit distance is at least the difference in length, so bail out
+  // cheaply before doing the quadratic edit-distance computation when the
+  // lengths alone rule the candidate out. Failure-path lookups run this
+  // predicate over every visible decl, so the fast rejection matters.
+  size_t lengthDelta = writtenBase.size() > correctedBase.size()
+                           ? writtenBase.size() - correctedBase.size()
+                           : correctedBase.size() - writtenBase.size();
+  if (lengthDelta >= maxEditDistance)
+    return UnreasonableCallEditDistance;
+
   unsigned distance = writtenBase.edit_distance(correctedBase, maxEditDistance);
 
   // Bound the distance to UnreasonableCallEditDistance.
@@ -598,8 +608,15 @@ void TypeChecker::performTypoCorrection(DeclContext *DC, DeclRefKind refKind,
 
   // Fill in a collection of the most reasonable entries.
   TopCollection<unsigned, ValueDecl *> entries(maxResults);
+  unsigned candidatesExamined = 0;
   auto consumer = makeDeclConsumer([&](ValueDecl *decl,
                                        DeclVisibilityKind reason) {
+    // Respect the per-correction budget; in huge scopes the remaining
+    // candidates are unlikely to beat what we've already collected, and we
+    // are on a failure path that only produces a note.
+    if (++candidatesExamined > MaxTypoCorrectionCandidatesExamined)
+      return;
+
     // Never match an operator with an identifier or vice-versa; this is
     // not a plausible typo.
     if (!isPlausibleTypo(refKind, corrections.WrittenName, decl))
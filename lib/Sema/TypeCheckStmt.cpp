@@ -52,6 +52,7 @@
 #include "llvm/Support/Debug.h"
 #include "llvm/Support/Format.h"
 #include "llvm/Support/Timer.h"
+#include <chrono>
 #include <cmath>
 #include <iterator>
 
@@ -153,18 +154,23 @@ namespace {
   };
 
   /// Used for debugging which parts of the code are taking a long time to
-  /// compile.
+  /// compile. Measures monotonic wall time: unlike llvm::TimeRecord's
+  /// process-time query, reading the monotonic clock does not syscall into
+  /// getrusage, so the timer is cheap enough to leave enabled in regular
+  /// builds (e.g. a standing -warn-long-function-bodies budget in CI).
   class FunctionBodyTimer {
     AnyFunctionRef Function;
-    llvm::TimeRecord StartTime = llvm::TimeRecord::getCurrentTime();
+    std::chrono::steady_clock::time_point StartTime =
+        std::chrono::steady_clock::now();
 
   public:
     FunctionBodyTimer(AnyFunctionRef Fn) : Function(Fn) {}
 
     ~FunctionBodyTimer() {
-      llvm::TimeRecord endTime = llvm::TimeRecord::getCurrentTime(false);
+      auto endTime = std::chrono::steady_clock::now();
 
-      auto elapsed = endTime.getProcessTime() - StartTime.getProcessTime();
+      double elapsed =
+          std::chrono::duration<double>(endTime - StartTime).count();
       unsigned elapsedMS = static_cast<unsigned>(elapsed * 1000);
 
       ASTContext &ctx = Function.getAsDeclContext()->getASTContext();
@@ -2890,6 +2896,15 @@ TypeCheckFunctionBodyRequest::evaluate(Evaluator &eval,
   if (AFD->isBodyTypeChecked())
     return body;
 
+  // Record how many bodies we typecheck and how many of those carry a
+  // parse-time fingerprint; only the latter are candidates for
+  // fingerprint-keyed incremental skipping.
+  if (auto *Stats = ctx.Stats) {
+    ++Stats->getFrontendCounters().NumFunctionBodiesTypechecked;
+    if (AFD->getBodyFingerprint())
+      ++Stats->getFrontendCounters().NumFunctionBodiesWithFingerprint;
+  }
+
   auto errorBody = [&]() {
     // If we had an error, return an ErrorExpr body instead of returning the
     // un-type-checked body.
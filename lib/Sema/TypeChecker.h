@@ -1212,7 +1212,14 @@ enum : unsigned {
 
   /// Don't consider candidates that score worse than the given distance
   /// from the best candidate.
-  MaxCallEditDistanceFromBestCandidate = 1
+  MaxCallEditDistanceFromBestCandidate = 1,
+
+  /// Stop scoring candidates for a single correction after examining this
+  /// many visible declarations, so the cost of a failure-path lookup stops
+  /// growing with the number of visible names. The budget is a candidate
+  /// count rather than a wall-clock limit so that the suggestions emitted
+  /// for a given input stay deterministic.
+  MaxTypoCorrectionCandidatesExamined = 16384
 };
 
 /// Check for a typo correction.
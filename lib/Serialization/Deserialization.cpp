@@ -45,6 +45,7 @@
 #include "clang/Basic/SourceManager.h"
 #include "clang/Basic/AttributeCommonInfo.h"
 #include "clang/Index/USRGeneration.h"
+#include "llvm/ADT/ScopeExit.h"
 #include "llvm/ADT/Statistic.h"
 #include "llvm/Support/Compiler.h"
 #include "llvm/Support/Debug.h"
@@ -71,6 +72,9 @@ STATISTIC(NumNormalProtocolConformancesLoaded,
           "# of normal protocol conformances deserialized");
 STATISTIC(NumNormalProtocolConformancesCompleted,
           "# of normal protocol conformances completed");
+STATISTIC(NumDeclBitsRead, "# of bits read deserializing decls");
+STATISTIC(NumXRefsResolved, "# of cross-references resolved by name lookup");
+STATISTIC(NumTypeBitsRead, "# of bits read deserializing types");
 STATISTIC(NumNestedTypeShortcuts,
           "# of nested types resolved without full lookup");
 
@@ -1982,6 +1986,12 @@ ModuleFile::resolveCrossReference(ModuleID MID, uint32_t pathLen) {
   assert(baseModule && "missing dependency");
   PrettyXRefTrace pathTrace(*baseModule);
 
+  // Each cross-reference record resolves at most once per ModuleFile: the
+  // result is memoized by DeclID in `Decls`, and the serializer assigns every
+  // referenced decl a single ID, so identical (module, path) references share
+  // a record. This counts the lookups that actually happen.
+  ++NumXRefsResolved;
+
   llvm::BitstreamEntry entry =
       fatalIfUnexpected(DeclTypeCursor.advance(AF_DontPopBlockAtEnd));
   if (entry.Kind != llvm::BitstreamEntry::Record)
@@ -5494,11 +5504,19 @@ ModuleFile::getDeclChecked(
             diagnoseFatalIfNotSuccess(DeclTypeCursor.JumpToBit(declOrOffset)))
       return std::move(error);
 
+    // The decl offset table makes this a single seek; measure how much of
+    // the stream each decl actually consumes once we're there.
+    uint64_t startBit = DeclTypeCursor.GetCurrentBitNo();
+
     Expected<Decl *> deserialized =
       DeclDeserializer(*this, declOrOffset).getDeclCheckedImpl(
         matchAttributes);
     if (!deserialized)
       return deserialized;
+
+    uint64_t endBit = DeclTypeCursor.GetCurrentBitNo();
+    if (endBit > startBit)
+      NumDeclBitsRead += endBit - startBit;
   } else if (matchAttributes) {
     // Decl was cached but we may need to filter it
     if (!matchAttributes(declOrOffset.get()->getAttrs()))
@@ -7865,6 +7883,13 @@ Expected<Type> ModuleFile::getTypeChecked(TypeID TID) {
     if (auto s = getContext().Stats)
       ++s->getFrontendCounters().NumTypesDeserialized;
 
+    uint64_t startBit = DeclTypeCursor.GetCurrentBitNo();
+    auto countBitsRead = llvm::make_scope_exit([&] {
+      uint64_t endBit = DeclTypeCursor.GetCurrentBitNo();
+      if (endBit > startBit)
+        NumTypeBitsRead += endBit - startBit;
+    });
+
     llvm::BitstreamEntry entry =
         fatalIfUnexpected(DeclTypeCursor.advance());
 
@@ -569,7 +569,8 @@ SILDeserializer::readSILFunctionChecked(DeclID FID, SILFunction *existingFn,
       optimizationMode, perfConstr, subclassScope, hasCReferences, effect,
       numAttrs, hasQualifiedOwnership, isWeakImported,
       LIST_VER_TUPLE_PIECES(available), isDynamic, isExactSelfClass,
-      isDistributed, isRuntimeAccessible, forceEnableLexicalLifetimes;
+      isDistributed, isRuntimeAccessible, forceEnableLexicalLifetimes,
+      numInstructions;
   ArrayRef<uint64_t> SemanticsIDs;
   SILFunctionLayout::readRecord(
       scratch, rawLinkage, isTransparent, serializedKind, isThunk,
@@ -577,9 +578,10 @@ SILDeserializer::readSILFunctionChecked(DeclID FID, SILFunction *existingFn,
       optimizationMode, perfConstr, subclassScope, hasCReferences, effect,
       numAttrs, hasQualifiedOwnership, isWeakImported,
       LIST_VER_TUPLE_PIECES(available), isDynamic, isExactSelfClass,
-      isDistributed, isRuntimeAccessible, forceEnableLexicalLifetimes, funcTyID,
-      replacedFunctionID, usedAdHocWitnessFunctionID, genericSigID,
-      clangNodeOwnerID, parentModuleID, SemanticsIDs);
+      isDistributed, isRuntimeAccessible, forceEnableLexicalLifetimes,
+      numInstructions, funcTyID, replacedFunctionID,
+      usedAdHocWitnessFunctionID, genericSigID, clangNodeOwnerID,
+      parentModuleID, SemanticsIDs);
 
   if (funcTyID == 0)
     return MF->diagnoseFatal("SILFunction typeID is 0");
@@ -763,6 +765,10 @@ SILDeserializer::readSILFunctionChecked(DeclID FID, SILFunction *existingFn,
   // function. Ownership doesn't really have a meaning without a body.
   builder.setHasOwnership(fn, hasQualifiedOwnership);
 
+  // Remember the serialized body size so clients can judge the cost of
+  // this function without walking its instructions.
+  fn->setSerializedInstructionCount(numInstructions);
+
   // Mark this function as deserialized. This avoids rerunning diagnostic
   // passes. Certain passes in the mandatory pipeline may not work as expected
   // after arbitrary optimization and lowering.
@@ -3498,6 +3504,12 @@ bool SILDeserializer::hasSILFunction(StringRef Name,
       (cacheEntry.isDeserialized()))
     return !Linkage || cacheEntry.get()->getLinkage() == *Linkage;
 
+  // If we already decoded this function's serialized linkage on a previous
+  // query, don't re-read the record from the bitcode.
+  auto cachedLinkage = FuncLinkageCache.find(FID);
+  if (cachedLinkage != FuncLinkageCache.end())
+    return !Linkage || cachedLinkage->second == *Linkage;
+
   BCOffsetRAII restoreOffset(SILCursor);
   if (llvm::Error Err = SILCursor.JumpToBit(cacheEntry.getOffset())) {
     MF->diagnoseAndConsumeFatal(std::move(Err));
@@ -3527,8 +3539,6 @@ bool SILDeserializer::hasSILFunction(StringRef Name,
   (void)kind;
 
   // Read function properties only, e.g. its linkage and other attributes.
-  // TODO: If this results in any noticeable performance problems, Cache the
-  // linkage to avoid re-reading it from the bitcode each time?
   DeclID clangOwnerID;
   ModuleID parentModuleID;
   TypeID funcTyID;
@@ -3540,7 +3550,8 @@ bool SILDeserializer::hasSILFunction(StringRef Name,
       optimizationMode, perfConstr, subclassScope, hasCReferences, effect,
       numSpecAttrs, hasQualifiedOwnership, isWeakImported,
       LIST_VER_TUPLE_PIECES(available), isDynamic, isExactSelfClass,
-      isDistributed, isRuntimeAccessible, forceEnableLexicalLifetimes;
+      isDistributed, isRuntimeAccessible, forceEnableLexicalLifetimes,
+      numInstructions;
   ArrayRef<uint64_t> SemanticsIDs;
   SILFunctionLayout::readRecord(
       scratch, rawLinkage, isTransparent, serializedKind, isThunk,
@@ -3548,9 +3559,10 @@ bool SILDeserializer::hasSILFunction(StringRef Name,
       optimizationMode, perfConstr, subclassScope, hasCReferences, effect,
       numSpecAttrs, hasQualifiedOwnership, isWeakImported,
       LIST_VER_TUPLE_PIECES(available), isDynamic, isExactSelfClass,
-      isDistributed, isRuntimeAccessible, forceEnableLexicalLifetimes, funcTyID,
-      replacedFunctionID, usedAdHocWitnessFunctionID, genericSigID,
-      clangOwnerID, parentModuleID, SemanticsIDs);
+      isDistributed, isRuntimeAccessible, forceEnableLexicalLifetimes,
+      numInstructions, funcTyID, replacedFunctionID,
+      usedAdHocWitnessFunctionID, genericSigID, clangOwnerID, parentModuleID,
+      SemanticsIDs);
   auto linkage = fromStableSILLinkage(rawLinkage);
   if (!linkage) {
     LLVM_DEBUG(llvm::dbgs() << "invalid linkage code " << rawLinkage
@@ -3558,6 +3570,8 @@ bool SILDeserializer::hasSILFunction(StringRef Name,
     return false;
   }
 
+  FuncLinkageCache[FID] = linkage.value();
+
   // Bail if it is not a required linkage.
   if (Linkage && linkage.value() != *Linkage)
     return false;
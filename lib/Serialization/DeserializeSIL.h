@@ -85,6 +85,13 @@ namespace swift {
     // Before adding a new cache here, please read the comment at the
     // beginning of the deserialization cache section.
 
+    /// Cache of the serialized linkage of not-yet-deserialized functions,
+    /// keyed by function ID, so that repeated \c hasSILFunction queries do
+    /// not have to re-read the function record from the bitcode each time.
+    /// This holds values decoded from the immutable serialized record, not
+    /// pointers into the SILModule, so it needs no invalidation.
+    llvm::DenseMap<serialization::DeclID, SILLinkage> FuncLinkageCache;
+
     /// A declaration will only
     llvm::DenseMap<NormalProtocolConformance *, SILWitnessTable *>
     ConformanceToWitnessTableMap;
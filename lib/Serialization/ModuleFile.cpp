@@ -347,39 +347,55 @@ void ModuleFile::lookupValue(DeclName name,
     // FIXME: As a bit of a hack, do lookup by the simple name, then filter
     // compound decls, to avoid having to completely redo how modules are
     // serialized.
-    auto iter = Core->TopLevelDecls->find(name.getBaseName());
-    if (iter != Core->TopLevelDecls->end()) {
-      for (auto item : *iter) {
-        Expected<Decl *> declOrError = getDeclChecked(item.second);
-        if (!declOrError) {
-          if (!getContext().LangOpts.EnableDeserializationRecovery)
-            fatal(declOrError.takeError());
-          diagnoseAndConsumeError(declOrError.takeError());
-          continue;
+    auto cached = TopLevelDeclCache.find(name.getBaseName());
+    if (cached == TopLevelDeclCache.end()) {
+      // Deserializing the decls below can re-enter lookupValue, so build the
+      // list locally and only insert it into the cache afterwards.
+      std::vector<ValueDecl *> decls;
+      auto iter = Core->TopLevelDecls->find(name.getBaseName());
+      if (iter != Core->TopLevelDecls->end()) {
+        for (auto item : *iter) {
+          Expected<Decl *> declOrError = getDeclChecked(item.second);
+          if (!declOrError) {
+            if (!getContext().LangOpts.EnableDeserializationRecovery)
+              fatal(declOrError.takeError());
+            diagnoseAndConsumeError(declOrError.takeError());
+            continue;
+          }
+          decls.push_back(cast<ValueDecl>(declOrError.get()));
         }
-        auto VD = cast<ValueDecl>(declOrError.get());
-        if (name.isSimpleName() || VD->getName().matchesRef(name))
-          results.push_back(VD);
       }
+      cached = TopLevelDeclCache.try_emplace(name.getBaseName(),
+                                             std::move(decls)).first;
+    }
+    for (auto VD : cached->second) {
+      if (name.isSimpleName() || VD->getName().matchesRef(name))
+        results.push_back(VD);
     }
   }
 
   // If the name is an operator name, also look for operator methods.
   if (name.isOperator() && Core->OperatorMethodDecls) {
-    auto iter = Core->OperatorMethodDecls->find(name.getBaseName());
-    if (iter != Core->OperatorMethodDecls->end()) {
-      for (auto item : *iter) {
-        Expected<Decl *> declOrError = getDeclChecked(item.second);
-        if (!declOrError) {
-          if (!getContext().LangOpts.EnableDeserializationRecovery)
-            fatal(declOrError.takeError());
-          diagnoseAndConsumeError(declOrError.takeError());
-          continue;
+    auto cached = OperatorMethodDeclCache.find(name.getBaseName());
+    if (cached == OperatorMethodDeclCache.end()) {
+      std::vector<ValueDecl *> decls;
+      auto iter = Core->OperatorMethodDecls->find(name.getBaseName());
+      if (iter != Core->OperatorMethodDecls->end()) {
+        for (auto item : *iter) {
+          Expected<Decl *> declOrError = getDeclChecked(item.second);
+          if (!declOrError) {
+            if (!getContext().LangOpts.EnableDeserializationRecovery)
+              fatal(declOrError.takeError());
+            diagnoseAndConsumeError(declOrError.takeError());
+            continue;
+          }
+          decls.push_back(cast<ValueDecl>(declOrError.get()));
         }
-        auto VD = cast<ValueDecl>(declOrError.get());
-        results.push_back(VD);
       }
+      cached = OperatorMethodDeclCache.try_emplace(name.getBaseName(),
+                                                   std::move(decls)).first;
     }
+    results.append(cached->second.begin(), cached->second.end());
   }
 }
 
@@ -1112,6 +1128,7 @@ void ModuleFile::collectSerializedSearchPath(
 
 void ModuleFile::collectBasicSourceFileInfo(
     llvm::function_ref<void(const BasicSourceFileInfo &)> callback) const {
+  Core->loadSourceInfoIfNeeded();
   if (Core->SourceFileListData.empty())
     return;
   assert(!Core->SourceLocsTextData.empty());
@@ -1194,6 +1211,7 @@ ModuleFile::getExternalRawLocsForDecl(const Decl *D) const {
   assert(D->getDeclContext()->getModuleScopeContext() == FileContext &&
          "Decl is from a different serialized file");
 
+  Core->loadSourceInfoIfNeeded();
   if (!Core->DeclUSRsTable)
     return std::nullopt;
   // Future compilers may not provide BasicDeclLocsData anymore.
@@ -316,6 +316,16 @@ private:
   llvm::DenseMap<const Decl *, Identifier> PrivateDiscriminatorsByValue;
   llvm::DenseMap<const Decl *, StringRef> FilenamesForPrivateValues;
 
+  /// Memoized results of lookupValue, including empty entries for names that
+  /// aren't in the module. The decl IDs recorded for a name never change once
+  /// the module is loaded, so repeated lookups can skip the on-disk hash
+  /// table probe and redundant deserialization checks.
+  llvm::DenseMap<DeclBaseName, std::vector<ValueDecl *>> TopLevelDeclCache;
+
+  /// Memoized results of the operator-method half of lookupValue, with the
+  /// same invariants as TopLevelDeclCache.
+  llvm::DenseMap<DeclBaseName, std::vector<ValueDecl *>> OperatorMethodDeclCache;
+
   TinyPtrVector<Decl *> ImportDecls;
 
   /// Maps USRs to their deserialized comment object.
@@ -1766,15 +1766,26 @@ ModuleFileSharedCore::ModuleFileSharedCore(
     info.status = error(Status::Malformed);
     return;
   }
-  // Read source info file.
-  readModuleSourceInfoIfPresent(pathRecoverer);
+  // Defer parsing the source info file until a consumer asks for a decl
+  // location; remember the recoverer it will need.
+  SourceInfoPathRecoverer = pathRecoverer;
   if (!readModuleDocIfPresent(pathRecoverer)) {
     info.status = error(Status::MalformedDocumentation);
     return;
   }
 }
 
+void ModuleFileSharedCore::loadSourceInfoIfNeeded() const {
+  llvm::call_once(SourceInfoLoadOnce, [this] {
+    // The shared core is immutable after construction apart from this
+    // deferred parse, which is safe to perform in place under the once flag.
+    auto *self = const_cast<ModuleFileSharedCore *>(this);
+    self->readModuleSourceInfoIfPresent(self->SourceInfoPathRecoverer);
+  });
+}
+
 bool ModuleFileSharedCore::hasSourceInfo() const {
+  loadSourceInfoIfNeeded();
   return !!DeclUSRsTable;
 }
 
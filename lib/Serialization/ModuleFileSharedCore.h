@@ -16,9 +16,11 @@
 #include "ModuleFormat.h"
 #include "swift/AST/LinkLibrary.h"
 #include "swift/AST/Module.h"
+#include "swift/Basic/PathRemapper.h"
 #include "swift/Serialization/Validation.h"
 #include "llvm/ADT/bit.h"
 #include "llvm/Bitstream/BitstreamReader.h"
+#include "llvm/Support/Threading.h"
 
 namespace llvm {
   template <typename Info> class OnDiskIterableChainedHashTable;
@@ -340,6 +342,15 @@ private:
   /// of declaration's documentation `RawComment`s.
   StringRef DocRangesData;
 
+  /// Guards the deferred parsing of #ModuleSourceInfoInputBuffer. Most module
+  /// loads never ask for a decl location, so the buffer is only parsed on the
+  /// first query instead of at construction time.
+  mutable llvm::once_flag SourceInfoLoadOnce;
+
+  /// The path recoverer to apply when #ModuleSourceInfoInputBuffer is
+  /// eventually parsed.
+  PathObfuscator SourceInfoPathRecoverer;
+
   struct ModuleBits {
     /// The decl ID of the main class in this module file, if it has one.
     unsigned EntryPointDeclID : 31;
@@ -522,6 +533,11 @@ private:
   /// Returns false if there was an error.
   bool readModuleSourceInfoIfPresent(PathObfuscator &pathRecoverer);
 
+  /// Parses #ModuleSourceInfoInputBuffer if that hasn't happened yet.
+  ///
+  /// Safe to call concurrently; parsing happens exactly once.
+  void loadSourceInfoIfNeeded() const;
+
   /// Read an on-disk decl hash table stored in
   /// \c sourceinfo_block::DeclUSRSLayout format.
   std::unique_ptr<SerializedDeclUSRTable>
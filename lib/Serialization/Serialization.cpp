@@ -6867,6 +6867,10 @@ void SerializerBase::writeToStream(raw_ostream &os) {
   os.flush();
 }
 
+SmallVector<char, 0> SerializerBase::takeBuffer() {
+  return std::move(Buffer);
+}
+
 SerializerBase::SerializerBase(ArrayRef<unsigned char> signature,
                                ModuleOrSourceFile DC) {
   for (unsigned char byte : signature)
@@ -6881,6 +6885,15 @@ void Serializer::writeToStream(
     const SILModule *SILMod,
     const SerializationOptions &options,
     const fine_grained_dependencies::SourceFileDepGraph *DepGraph) {
+  auto buffer = writeToBuffer(DC, SILMod, options, DepGraph);
+  os.write(buffer.data(), buffer.size());
+  os.flush();
+}
+
+SmallVector<char, 0> Serializer::writeToBuffer(
+    ModuleOrSourceFile DC, const SILModule *SILMod,
+    const SerializationOptions &options,
+    const fine_grained_dependencies::SourceFileDepGraph *DepGraph) {
   Serializer S{SWIFTMODULE_SIGNATURE, DC, options};
 
   // FIXME: This is only really needed for debugging. We don't actually use it.
@@ -6903,7 +6916,7 @@ void Serializer::writeToStream(
     }
   }
 
-  S.writeToStream(os);
+  return S.takeBuffer();
 }
 
 bool Serializer::allowCompilerErrors() const {
@@ -6958,3 +6971,10 @@ void serialization::writeToStream(
     const fine_grained_dependencies::SourceFileDepGraph *DepGraph) {
   Serializer::writeToStream(os, DC, M, options, DepGraph);
 }
+
+SmallVector<char, 0> serialization::writeToBuffer(
+    ModuleOrSourceFile DC, const SILModule *M,
+    const SerializationOptions &options,
+    const fine_grained_dependencies::SourceFileDepGraph *DepGraph) {
+  return Serializer::writeToBuffer(DC, M, options, DepGraph);
+}
@@ -72,6 +72,10 @@ protected:
 
   void writeToStream(raw_ostream &os);
 
+  /// Surrender ownership of the serialized bits, leaving the serializer
+  /// unusable. Lets callers hand the module image off without copying it.
+  SmallVector<char, 0> takeBuffer();
+
 public:
   SerializerBase(ArrayRef<unsigned char> signature, ModuleOrSourceFile DC);
 
@@ -449,6 +453,13 @@ public:
                 const SerializationOptions &options,
                 const fine_grained_dependencies::SourceFileDepGraph *DepGraph);
 
+  /// Serialize a module and return the serialized bits directly, without
+  /// copying them into a caller-provided stream.
+  static SmallVector<char, 0>
+  writeToBuffer(ModuleOrSourceFile DC, const SILModule *M,
+                const SerializationOptions &options,
+                const fine_grained_dependencies::SourceFileDepGraph *DepGraph);
+
   /// Records the use of the given Type.
   ///
   /// The Type will be scheduled for serialization if necessary.
@@ -514,6 +514,14 @@ void SILSerializer::writeSILFunction(const SILFunction &F, bool DeclOnly) {
   }
   ENCODE_VER_TUPLE(available, available)
 
+  // Record the body size so clients can cheaply judge the cost of
+  // deserializing this function without decoding its instructions.
+  unsigned numInstructions = 0;
+  if (!NoBody) {
+    for (const SILBasicBlock &BB : F)
+      numInstructions += std::distance(BB.begin(), BB.end());
+  }
+
   SILFunctionLayout::emitRecord(
       Out, ScratchRecord, abbrCode, toStableSILLinkage(Linkage),
       (unsigned)F.isTransparent(), (unsigned)F.getSerializedKind(),
@@ -526,7 +534,8 @@ void SILSerializer::writeSILFunction(const SILFunction &F, bool DeclOnly) {
       LIST_VER_TUPLE_PIECES(available), (unsigned)F.isDynamicallyReplaceable(),
       (unsigned)F.isExactSelfClass(), (unsigned)F.isDistributed(),
       (unsigned)F.isRuntimeAccessible(),
-      (unsigned)F.forceEnableLexicalLifetimes(), FnID, replacedFunctionID,
+      (unsigned)F.forceEnableLexicalLifetimes(), numInstructions, FnID,
+      replacedFunctionID,
       usedAdHocWitnessFunctionID, genericSigID, clangNodeOwnerID,
       parentModuleID, SemanticsIDs);
 
@@ -281,8 +281,11 @@ std::error_code SerializedModuleLoaderBase::openModuleDocFileIfPresent(
   SmallString<256>
   ModuleDocPath{BaseName.getName(file_types::TY_SwiftModuleDocFile)};
 
+  // Like the module file itself, the bitstream in the doc file is read with
+  // explicit bounds, so skip the null terminator to keep the buffer mmapable.
   llvm::ErrorOr<std::unique_ptr<llvm::MemoryBuffer>> ModuleDocOrErr =
-    FS.getBufferForFile(ModuleDocPath);
+    FS.getBufferForFile(ModuleDocPath, /*FileSize=*/-1,
+                        /*RequiresNullTerminator=*/false);
   if (ModuleDocOrErr) {
     *ModuleDocBuffer = std::move(*ModuleDocOrErr);
   } else if (ModuleDocOrErr.getError() !=
@@ -322,12 +325,16 @@ SerializedModuleLoaderBase::openModuleSourceInfoFileIfPresent(
 
   // Try to open the module source info file from the "Project" directory.
   llvm::ErrorOr<std::unique_ptr<llvm::MemoryBuffer>>
-  ModuleSourceInfoOrErr = FS.getBufferForFile(PathWithProjectDir);
+  ModuleSourceInfoOrErr = FS.getBufferForFile(PathWithProjectDir,
+                                              /*FileSize=*/-1,
+                                              /*RequiresNullTerminator=*/false);
 
   // If it does not exist, try to open the module source info file adjacent to
   // the .swiftmodule file.
   if (ModuleSourceInfoOrErr.getError() == std::errc::no_such_file_or_directory)
-    ModuleSourceInfoOrErr = FS.getBufferForFile(PathWithoutProjectDir);
+    ModuleSourceInfoOrErr =
+        FS.getBufferForFile(PathWithoutProjectDir, /*FileSize=*/-1,
+                            /*RequiresNullTerminator=*/false);
 
   // If we ended up with a different file system error, return it.
   if (ModuleSourceInfoOrErr)
@@ -379,11 +386,15 @@ std::error_code SerializedModuleLoaderBase::openModuleFile(
   // the surface look like memory corruption.
   //
   // rdar://63755989
+  // Bitstream reading is bounds-checked against the buffer size, so no null
+  // terminator is required. Not asking for one lets the buffer be mmapped and
+  // paged in lazily in all cases; with a terminator, files whose size is an
+  // exact multiple of the page size would be read and copied eagerly instead.
   bool enableVolatileModules = Ctx.LangOpts.EnableVolatileModules;
   llvm::ErrorOr<std::unique_ptr<llvm::MemoryBuffer>> ModuleOrErr =
       FS.getBufferForFile(ModulePath,
                           /*FileSize=*/-1,
-                          /*RequiresNullTerminator=*/true,
+                          /*RequiresNullTerminator=*/false,
                           /*IsVolatile=*/enableVolatileModules);
   if (!ModuleOrErr)
     return ModuleOrErr.getError();
@@ -22,6 +22,7 @@
 #include "llvm/ADT/StringSet.h"
 #include "llvm/Object/Archive.h"
 #include "llvm/Object/MachOUniversal.h"
+#include "llvm/Support/ThreadPool.h"
 
 #include <sstream>
 
@@ -33,25 +34,36 @@ namespace static_mirror {
 
 BinaryScanningTool::BinaryScanningTool(
     const std::vector<std::string> &binaryPaths, const std::string Arch) {
-  for (const std::string &BinaryFilename : binaryPaths) {
-    auto BinaryOwner = unwrap(createBinary(BinaryFilename));
-    Binary *BinaryFile = BinaryOwner.getBinary();
+  // Load the input binaries in parallel: parsing each object file is
+  // independent work, and audit-style scans commonly pass hundreds of images
+  // at once. Each load writes into its own pre-sized slot, so the merged
+  // image order matches the input order exactly as with serial loading.
+  BinaryOwners.resize(binaryPaths.size());
+  ObjectOwners.resize(binaryPaths.size());
+  ObjectFiles.resize(binaryPaths.size());
+  llvm::ThreadPool LoadPool(llvm::hardware_concurrency());
+  for (size_t Index = 0; Index < binaryPaths.size(); ++Index) {
+    LoadPool.async([this, &binaryPaths, &Arch, Index] {
+      auto BinaryOwner = unwrap(createBinary(binaryPaths[Index]));
+      Binary *BinaryFile = BinaryOwner.getBinary();
 
-    // The object file we are doing lookups in -- either the binary itself, or
-    // a particular slice of a universal binary.
-    std::unique_ptr<ObjectFile> ObjectOwner;
-    const ObjectFile *O = dyn_cast<ObjectFile>(BinaryFile);
-    if (!O) {
-      auto Universal = cast<MachOUniversalBinary>(BinaryFile);
-      ObjectOwner = unwrap(Universal->getMachOObjectForArch(Arch));
-      O = ObjectOwner.get();
-    }
+      // The object file we are doing lookups in -- either the binary itself,
+      // or a particular slice of a universal binary.
+      std::unique_ptr<ObjectFile> ObjectOwner;
+      const ObjectFile *O = dyn_cast<ObjectFile>(BinaryFile);
+      if (!O) {
+        auto Universal = cast<MachOUniversalBinary>(BinaryFile);
+        ObjectOwner = unwrap(Universal->getMachOObjectForArch(Arch));
+        O = ObjectOwner.get();
+      }
 
-    // Retain the objects that own section memory
-    BinaryOwners.push_back(std::move(BinaryOwner));
-    ObjectOwners.push_back(std::move(ObjectOwner));
-    ObjectFiles.push_back(O);
+      // Retain the objects that own section memory
+      BinaryOwners[Index] = std::move(BinaryOwner);
+      ObjectOwners[Index] = std::move(ObjectOwner);
+      ObjectFiles[Index] = O;
+    });
   }
+  LoadPool.wait();
   // FIXME: This could/should be configurable.
 #if SWIFT_OBJC_INTEROP
   bool ObjCInterop = true;
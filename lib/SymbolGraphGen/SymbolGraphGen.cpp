@@ -19,6 +19,7 @@
 #include "swift/Sema/IDETypeChecking.h"
 #include "llvm/ADT/STLExtras.h"
 #include "llvm/Support/JSON.h"
+#include "llvm/Support/MemoryBuffer.h"
 #include "llvm/Support/Path.h"
 
 #include "SymbolGraphASTWalker.h"
@@ -44,11 +45,26 @@ int serializeSymbolGraph(SymbolGraph &SG,
   SmallString<1024> OutputPath(Options.OutputDir);
   llvm::sys::path::append(OutputPath, FileName);
 
+  // Serialize into a buffer first so that an unchanged graph can leave the
+  // existing output file untouched. Documentation pipelines key off output
+  // modification times, so rewriting identical JSON forces spurious rebuilds
+  // downstream.
+  SmallString<0> Buffer;
+  {
+    llvm::raw_svector_ostream BufferOS(Buffer);
+    llvm::json::OStream J(BufferOS, Options.PrettyPrint ? 2 : 0);
+    SG.serialize(J);
+  }
+
+  if (auto Existing = llvm::MemoryBuffer::getFile(OutputPath)) {
+    if ((*Existing)->getBuffer() == Buffer)
+      return EXIT_SUCCESS;
+  }
+
   return withOutputPath(
       SG.M.getASTContext().Diags, SG.M.getASTContext().getOutputBackend(),
       OutputPath, [&](raw_ostream &OS) {
-        llvm::json::OStream J(OS, Options.PrettyPrint ? 2 : 0);
-        SG.serialize(J);
+        OS << Buffer;
         return false;
       });
 }
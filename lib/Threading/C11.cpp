@@ -19,6 +19,8 @@
 #include "swift/Threading/Impl.h"
 #include "swift/Threading/Errors.h"
 
+#include <cstdint>
+
 namespace {
 
 #pragma clang diagnostic push
@@ -26,26 +28,45 @@ namespace {
 
 class C11ThreadingHelper {
 private:
+  // Once predicates have no room for per-predicate wait machinery; stripe
+  // the mutex/condition pairs by predicate address so a thundering herd on
+  // one lazy global doesn't contend with every unrelated once in the
+  // process.
+  static const unsigned onceBucketCount_ = 16;
+
   thrd_t mainThread_;
-  mtx_t onceMutex_;
-  cnd_t onceCond_;
+  mtx_t onceMutexes_[onceBucketCount_];
+  cnd_t onceConds_[onceBucketCount_];
 
 public:
   C11ThreadingHelper() {
     mainThread_ = thrd_current();
-    SWIFT_C11THREADS_CHECK(::mtx_init(&onceMutex_, ::mtx_plain));
-    SWIFT_C11THREADS_CHECK(::cnd_init(&onceCond_));
+    for (unsigned i = 0; i < onceBucketCount_; ++i) {
+      SWIFT_C11THREADS_CHECK(::mtx_init(&onceMutexes_[i], ::mtx_plain));
+      SWIFT_C11THREADS_CHECK(::cnd_init(&onceConds_[i]));
+    }
   }
 
   thrd_t main_thread() const { return mainThread_; }
 
-  void once_lock() { SWIFT_C11THREADS_CHECK(mtx_lock(&onceMutex_)); }
-  void once_unlock() { SWIFT_C11THREADS_CHECK(mtx_unlock(&onceMutex_)); }
-  void once_broadcast() { SWIFT_C11THREADS_CHECK(cnd_broadcast(&onceCond_)); }
-  void once_wait() {
+  unsigned once_bucket(const void *predicate) {
+    auto address = reinterpret_cast<std::uintptr_t>(predicate);
+    return (address >> 4) % onceBucketCount_;
+  }
+
+  void once_lock(unsigned bucket) {
+    SWIFT_C11THREADS_CHECK(mtx_lock(&onceMutexes_[bucket]));
+  }
+  void once_unlock(unsigned bucket) {
+    SWIFT_C11THREADS_CHECK(mtx_unlock(&onceMutexes_[bucket]));
+  }
+  void once_broadcast(unsigned bucket) {
+    SWIFT_C11THREADS_CHECK(cnd_broadcast(&onceConds_[bucket]));
+  }
+  void once_wait(unsigned bucket) {
     // The mutex must be locked when this function is entered.  It will
     // be locked again before the function returns.
-    SWIFT_C11THREADS_CHECK(cnd_wait(&onceCond_, &onceMutex_));
+    SWIFT_C11THREADS_CHECK(cnd_wait(&onceConds_[bucket], &onceMutexes_[bucket]));
   }
 };
 
@@ -64,6 +85,8 @@ bool swift::threading_impl::thread_is_main() {
 
 void swift::threading_impl::once_slow(once_t &predicate, void (*fn)(void *),
                                       void *context) {
+  unsigned bucket = helper.once_bucket(&predicate);
+
   std::intptr_t zero = 0;
   if (predicate.compare_exchange_strong(zero, (std::intptr_t)1,
                                         std::memory_order_relaxed,
@@ -72,17 +95,25 @@ void swift::threading_impl::once_slow(once_t &predicate, void (*fn)(void *),
 
     predicate.store((std::intptr_t)-1, std::memory_order_release);
 
-    helper.once_lock();
-    helper.once_unlock();
-    helper.once_broadcast();
+    helper.once_lock(bucket);
+    helper.once_unlock(bucket);
+    helper.once_broadcast(bucket);
     return;
   }
 
-  helper.once_lock();
+  // The initializer is running on another thread; spin briefly before
+  // blocking, since many lazy initializers finish in far less time than a
+  // sleep/wake round trip costs.
+  for (unsigned i = 0; i < 128; ++i) {
+    if (predicate.load(std::memory_order_acquire) < (std::intptr_t)0)
+      return;
+  }
+
+  helper.once_lock(bucket);
   while (predicate.load(std::memory_order_acquire) >= (std::intptr_t)0) {
-    helper.once_wait();
+    helper.once_wait(bucket);
   }
-  helper.once_unlock();
+  helper.once_unlock(bucket);
 }
 
 #endif // SWIFT_THREADING_C11
@@ -23,6 +23,8 @@
 #include "swift/Threading/Impl.h"
 #include "swift/Threading/Errors.h"
 
+#include <cstdint>
+
 namespace {
 
 #pragma clang diagnostic push
@@ -39,8 +41,33 @@ public:
 };
 
 MainThreadRememberer rememberer;
-pthread_mutex_t onceMutex = PTHREAD_MUTEX_INITIALIZER;
-pthread_cond_t onceCond = PTHREAD_COND_INITIALIZER;
+
+// Once predicates have no room for per-predicate wait machinery, but sharing
+// a single global mutex/condition pair means a thundering herd on one lazy
+// global contends with — and is woken by — every unrelated once in the
+// process. Stripe the wait machinery by predicate address instead.
+struct OnceBucket {
+  pthread_mutex_t mutex;
+  pthread_cond_t cond;
+};
+
+#define ONCE_BUCKET_INITIALIZER                                                \
+  { PTHREAD_MUTEX_INITIALIZER, PTHREAD_COND_INITIALIZER }
+
+OnceBucket onceBuckets[16] = {
+    ONCE_BUCKET_INITIALIZER, ONCE_BUCKET_INITIALIZER, ONCE_BUCKET_INITIALIZER,
+    ONCE_BUCKET_INITIALIZER, ONCE_BUCKET_INITIALIZER, ONCE_BUCKET_INITIALIZER,
+    ONCE_BUCKET_INITIALIZER, ONCE_BUCKET_INITIALIZER, ONCE_BUCKET_INITIALIZER,
+    ONCE_BUCKET_INITIALIZER, ONCE_BUCKET_INITIALIZER, ONCE_BUCKET_INITIALIZER,
+    ONCE_BUCKET_INITIALIZER, ONCE_BUCKET_INITIALIZER, ONCE_BUCKET_INITIALIZER,
+    ONCE_BUCKET_INITIALIZER,
+};
+
+OnceBucket &onceBucketFor(const void *predicate) {
+  auto address = reinterpret_cast<std::uintptr_t>(predicate);
+  return onceBuckets[(address >> 4) % (sizeof(onceBuckets) /
+                                       sizeof(onceBuckets[0]))];
+}
 
 #pragma clang diagnostic pop
 
@@ -55,6 +82,8 @@ bool swift::threading_impl::thread_is_main() {
 
 void swift::threading_impl::once_slow(once_t &predicate, void (*fn)(void *),
                                       void *context) {
+  OnceBucket &bucket = onceBucketFor(&predicate);
+
   std::intptr_t zero = 0;
   if (predicate.compare_exchange_strong(zero, (std::intptr_t)1,
                                         std::memory_order_relaxed,
@@ -63,17 +92,25 @@ void swift::threading_impl::once_slow(once_t &predicate, void (*fn)(void *),
 
     predicate.store((std::intptr_t)-1, std::memory_order_release);
 
-    pthread_mutex_lock(&onceMutex);
-    pthread_mutex_unlock(&onceMutex);
-    pthread_cond_broadcast(&onceCond);
+    pthread_mutex_lock(&bucket.mutex);
+    pthread_mutex_unlock(&bucket.mutex);
+    pthread_cond_broadcast(&bucket.cond);
     return;
   }
 
-  pthread_mutex_lock(&onceMutex);
+  // The initializer is running on another thread; spin briefly before
+  // blocking, since many lazy initializers finish in far less time than a
+  // sleep/wake round trip costs.
+  for (unsigned i = 0; i < 128; ++i) {
+    if (predicate.load(std::memory_order_acquire) < (std::intptr_t)0)
+      return;
+  }
+
+  pthread_mutex_lock(&bucket.mutex);
   while (predicate.load(std::memory_order_acquire) >= (std::intptr_t)0) {
-    pthread_cond_wait(&onceCond, &onceMutex);
+    pthread_cond_wait(&bucket.cond, &bucket.mutex);
   }
-  pthread_mutex_unlock(&onceMutex);
+  pthread_mutex_unlock(&bucket.mutex);
 }
 
 #if defined(__OpenBSD__)
@@ -274,6 +274,51 @@ public struct Backtrace: CustomStringConvertible, Sendable {
     }
   }
 
+  /// Capture a backtrace from the current program location, reusing a
+  /// previously captured image list.
+  ///
+  /// Capturing the image list (on Linux, a scan of `/proc/self/maps`) can
+  /// cost more than the frame walk itself, so callers that capture stacks
+  /// in bulk should capture the images once with `captureImages()` and pass
+  /// them to every capture.  The list stays valid for as long as no images
+  /// are loaded or unloaded.
+  ///
+  /// Other than taking the image list as a parameter, this behaves exactly
+  /// like `capture(algorithm:limit:offset:top:)`.
+  ///
+  /// @param images        The image list from a prior `captureImages()` call.
+  /// @param algorithm     Specifies which unwind mechanism to use.  If this
+  ///                      is set to `.auto`, we will use the platform default.
+  /// @param limit         The backtrace will include at most this number of
+  ///                      frames; you can set this to `nil` to remove the
+  ///                      limit completely if required.
+  /// @param offset        Says how many frames to skip; this makes it easy to
+  ///                      wrap this API without having to inline things and
+  ///                      without including unnecessary frames in the backtrace.
+  /// @param top           Sets the minimum number of frames to capture at the
+  ///                      top of the stack.
+  ///
+  /// @returns A new `Backtrace` struct.
+  @inline(never)
+  @_semantics("use_frame_pointer")
+  public static func capture(images: [Image],
+                             algorithm: UnwindAlgorithm = .auto,
+                             limit: Int? = 64,
+                             offset: Int = 0,
+                             top: Int = 16) throws -> Backtrace {
+    // N.B. We use offset+1 here to skip this frame, rather than inlining
+    //      this code into the client.
+    return try HostContext.withCurrentContext { ctx in
+      try capture(from: ctx,
+                  using: UnsafeLocalMemoryReader(),
+                  images: images,
+                  algorithm: algorithm,
+                  limit: limit,
+                  offset: offset + 1,
+                  top: top)
+    }
+  }
+
   @_spi(Internal)
   public static func capture<Ctx: Context, Rdr: MemoryReader>(
     from context: Ctx,
@@ -379,6 +424,9 @@ public struct Backtrace: CustomStringConvertible, Sendable {
   /// Capture a list of the images currently mapped into the calling
   /// process.
   ///
+  /// The result can be passed to `capture(images:algorithm:limit:offset:top:)`
+  /// to amortize this work across many captures.
+  ///
   /// @returns A list of `Image`s.
   public static func captureImages() -> [Image] {
     #if os(macOS) || os(iOS) || os(watchOS) || os(tvOS)
@@ -10,6 +10,14 @@
 //
 //===----------------------------------------------------------------------===//
 
+// This file only vends the platform mutex that AsyncStream's Swift-side
+// storage (AsyncStreamBuffer.swift) embeds; the buffering logic itself lives
+// there. The lock is not just protecting the element buffer: it serializes
+// yields from arbitrary threads against consumer-continuation handoff, and
+// AsyncStream places no single-producer/single-consumer restriction on its
+// API, so a lock-free SPSC ring cannot be negotiated at this layer without
+// changing the type's documented semantics.
+
 #include <new>
 
 #include "swift/Runtime/Config.h"
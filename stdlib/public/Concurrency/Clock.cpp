@@ -25,6 +25,20 @@
 
 using namespace swift;
 
+#if defined(_WIN32)
+/// The performance counter frequency is fixed at boot, so query it once
+/// instead of paying for a QueryPerformanceFrequency call on every clock
+/// read.
+static LARGE_INTEGER getPerformanceFrequency() {
+  static LARGE_INTEGER freq;
+  static swift::once_t onceToken;
+  swift::once(onceToken, [] {
+    QueryPerformanceFrequency(&freq);
+  });
+  return freq;
+}
+#endif
+
 SWIFT_EXPORT_FROM(swift_Concurrency)
 SWIFT_CC(swift)
 void swift_get_time(
@@ -41,8 +55,7 @@ void swift_get_time(
 #elif (defined(__OpenBSD__) || defined(__FreeBSD__) || defined(__wasi__))
       clock_gettime(CLOCK_MONOTONIC, &continuous);
 #elif defined(_WIN32)
-      LARGE_INTEGER freq;
-      QueryPerformanceFrequency(&freq);
+      LARGE_INTEGER freq = getPerformanceFrequency();
       LARGE_INTEGER count;
       QueryPerformanceCounter(&count);
       // Divide count (number of ticks) by frequency (number of ticks per
@@ -128,8 +141,7 @@ switch (clock_id) {
 #elif (defined(__OpenBSD__) || defined(__FreeBSD__) || defined(__wasi__))
       clock_getres(CLOCK_MONOTONIC, &continuous);
 #elif defined(_WIN32)
-      LARGE_INTEGER freq;
-      QueryPerformanceFrequency(&freq);
+      LARGE_INTEGER freq = getPerformanceFrequency();
       continuous.tv_sec = 0;
       continuous.tv_nsec = 1'000'000'000 / freq.QuadPart;
 #else
@@ -859,6 +859,13 @@ swift_task_create_commonImpl(size_t rawTaskCreateFlags,
     assert(amountToAllocate <= runInlineBufferBytes);
     allocation = runInlineOption->getAllocation();
     initialSlabSize = runInlineBufferBytes - amountToAllocate;
+  } else if (group) {
+    // Group child tasks are created and completed in bulk in fan-out
+    // patterns. Carry the initial allocator slab in the same block as the
+    // task so each child costs one heap allocation instead of two (the task
+    // plus the allocator's first slab), mirroring what async let does with
+    // its preallocated space.
+    allocation = malloc(amountToAllocate + initialSlabSize);
   } else {
     allocation = malloc(amountToAllocate);
   }
@@ -966,7 +973,8 @@ swift_task_create_commonImpl(size_t rawTaskCreateFlags,
                             asyncLet         ? &completeTask
                             : closureContext ? &completeTaskWithClosure
                                              : &completeTaskAndRelease);
-  if ((asyncLet || (runInlineOption && runInlineOption->getAllocation())) &&
+  if ((asyncLet || group ||
+       (runInlineOption && runInlineOption->getAllocation())) &&
       initialSlabSize > 0) {
     assert(parent || (runInlineOption && runInlineOption->getAllocation()));
     void *initialSlab = (char*)allocation + amountToAllocate;
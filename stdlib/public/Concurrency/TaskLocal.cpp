@@ -324,6 +324,7 @@ void TaskLocal::Item::destroy(AsyncTask *task) {
 void TaskLocal::Storage::destroy(AsyncTask *task) {
   auto item = head;
   head = nullptr;
+  recentLookup = nullptr;
   TaskLocal::Item *next;
   while (item) {
     auto linkType = item->getNextLinkType();
@@ -355,11 +356,16 @@ void TaskLocal::Storage::pushValue(AsyncTask *task,
   auto item = Item::createLink(task, key, valueType);
   valueType->vw_initializeWithTake(item->getStoragePtr(), value);
   head = item;
+  // The new binding shadows any cached item for the same key; it is also the
+  // binding most likely to be read next.
+  recentLookup = item;
 }
 
 bool TaskLocal::Storage::popValue(AsyncTask *task) {
   assert(head && "attempted to pop value off empty task-local stack");
   auto old = head;
+  if (recentLookup == old)
+    recentLookup = nullptr;
   head = head->getNext();
   old->destroy(task);
 
@@ -371,9 +377,14 @@ OpaqueValue* TaskLocal::Storage::getValue(AsyncTask *task,
                                           const HeapObject *key) {
   assert(key && "TaskLocal key must not be null.");
 
+  if (recentLookup && recentLookup->key == key) {
+    return recentLookup->getStoragePtr();
+  }
+
   auto item = head;
   while (item) {
     if (item->key == key) {
+      recentLookup = item;
       return item->getStoragePtr();
     }
 
@@ -49,8 +49,7 @@ void actor_dequeue(HeapObject *actor, Job *job);
 // invalid/unknown = 255
 void actor_state_changed(HeapObject *actor, Job *firstJob,
                          bool needsPreprocessing, uint8_t state,
-                         bool isDistributedRemote, bool isPriorityEscalated,
-                         uint8_t maxPriority);
+                         bool isPriorityEscalated, uint8_t maxPriority);
 
 void actor_note_job_queue(HeapObject *actor, Job *first,
                           Job *(*getNext)(Job *));
@@ -22,6 +22,7 @@
 #include "swift/ABI/Task.h"
 #include "swift/Basic/Lazy.h"
 #include "swift/Runtime/Casting.h"
+#include "swift/Runtime/Concurrency.h"
 #include "swift/Runtime/HeapObject.h"
 #include "swift/Runtime/TracingCommon.h"
 #include <inttypes.h>
@@ -145,9 +146,11 @@ inline void actor_dequeue(HeapObject *actor, Job *job) {
 
 inline void actor_state_changed(HeapObject *actor, Job *firstJob,
                                 bool needsPreprocessing, uint8_t state,
-                                bool isDistributedRemote,
                                 bool isPriorityEscalated, uint8_t maxPriority) {
   ENSURE_LOGS();
+  // Only compute this when tracing is live; it costs a metadata walk per
+  // call, which is pure overhead on the enqueue path otherwise.
+  bool isDistributedRemote = swift_distributed_actor_is_remote(actor);
   auto id = os_signpost_id_make_with_pointer(ActorLog, actor);
   os_signpost_event_emit(ActorLog, id, SWIFT_LOG_ACTOR_STATE_CHANGED_NAME,
                          "actor=%p needsPreprocessing=%d "
@@ -822,21 +822,38 @@ TypeRefBuilder::ReflectionTypeDescriptorFinder::collectFieldTypes(
 
 void TypeRefBuilder::ReflectionTypeDescriptorFinder::dumpFieldSection(
     std::ostream &stream) {
-  auto fieldInfoCollectionResult =
-      collectFieldTypes(std::optional<std::string>());
-  for (const auto &info : fieldInfoCollectionResult.FieldInfos) {
-    stream << info.FullyQualifiedName << "\n";
-    for (size_t i = 0; i < info.FullyQualifiedName.size(); ++i)
-      stream << "-";
-    stream << "\n";
-    for (const auto &field : info.Properties) {
-      stream << field.Label;
-      stream << ": ";
-      stream << field.TypeDiagnosticPrintName;
-    }
-    for (const auto &field : info.EnumCases) {
-      stream << field.Label;
-      stream << "\n\n";
+  // Stream each descriptor as it is decoded rather than materializing the
+  // whole collection first: for large binaries, collectFieldTypes builds a
+  // per-property printed string for every field in the section, and holding
+  // all of that in memory just to print it dominates the dump's footprint.
+  for (const auto &sections : ReflectionInfos) {
+    for (auto descriptor : sections.Field) {
+      std::optional<std::string> optionalMangledTypeName;
+      std::string typeName;
+      {
+        TypeRefBuilder::ScopedNodeFactoryCheckpoint checkpoint(&Builder);
+        auto typeRef = readTypeRef(descriptor, descriptor->MangledTypeName);
+        typeName = nodeToString(Builder.demangleTypeRef(typeRef));
+        optionalMangledTypeName = normalizeReflectionName(typeRef);
+      }
+      if (!optionalMangledTypeName.has_value())
+        continue;
+
+      stream << typeName << "\n";
+      for (size_t i = 0; i < typeName.size(); ++i)
+        stream << "-";
+      stream << "\n";
+      for (auto &fieldRef : *descriptor.getLocalBuffer()) {
+        auto field = descriptor.getField(fieldRef);
+        auto fieldName =
+            Builder.getTypeRefString(readTypeRef(field, field->FieldName));
+        if (field->hasMangledTypeName()) {
+          stream << fieldName.str() << ": ";
+          dumpTypeRef(readTypeRef(field, field->MangledTypeName), stream);
+        } else {
+          stream << fieldName.str() << "\n\n";
+        }
+      }
     }
   }
 }
@@ -27,6 +27,7 @@ SWIFT_REMOTE_MIRROR_LINKAGE uint32_t swift_reflection_libraryVersion = 3;
 #include "swift/RemoteInspection/ReflectionContext.h"
 #include "swift/RemoteInspection/TypeLowering.h"
 #include "swift/Remote/CMemoryReader.h"
+#include "swift/Remote/CachingMemoryReader.h"
 #include "swift/Basic/Unreachable.h"
 
 #if defined(__APPLE__) && defined(__MACH__)
@@ -59,7 +60,11 @@ struct SwiftReflectionContext {
   std::function<void(void)> freeTemporaryAllocation = [] {};
 
   SwiftReflectionContext(bool objCInteropIsEnabled, MemoryReaderImpl impl) {
-    auto Reader = std::make_shared<CMemoryReader>(impl);
+    // Clients drive the context with a suspended process or a core file, and
+    // each small metadata read through the C callbacks can be a round trip,
+    // so serve reads through a page-granular cache of target memory.
+    auto Reader = std::make_shared<CachingMemoryReader>(
+        std::make_shared<CMemoryReader>(impl));
     if (objCInteropIsEnabled) {
       context = std::make_unique<ReflectionContextWithObjCInterop>(Reader);
     } else {
@@ -101,13 +101,25 @@ typedef InlineRefCountsPlaceholder InlineRefCounts;
   InlineRefCountBits and SideTableRefCountBits share some implementation
   via RefCountBitsT<bool>.
 
-  In general: The InlineRefCounts implementation tries to perform the 
-  operation inline. If the object has a side table it calls the 
-  HeapObjectSideTableEntry implementation which in turn calls the 
-  SideTableRefCounts implementation. 
+  In general: The InlineRefCounts implementation tries to perform the
+  operation inline. If the object has a side table it calls the
+  HeapObjectSideTableEntry implementation which in turn calls the
+  SideTableRefCounts implementation.
   Downside: this code is a bit twisted.
   Upside: this code has less duplication than it might otherwise
 
+  A note on biased (owner-thread) reference counting: schemes that let the
+  allocating thread count non-atomically and push other threads through a
+  transfer protocol have been considered and rejected here. The refcount
+  word's layout is ABI: it is read directly by compiled code, the debugger,
+  and the leaks/heap tools, and it has no spare state to name an owning
+  thread without growing HeapObject. The transfer protocol also taxes every
+  release with an owner check, which costs the shared objects it cannot
+  help. Thread-locality is instead exploited where it can be proven: the
+  compiler emits swift_nonatomic_retain/release for references it knows do
+  not escape their thread, and SWIFT_STDLIB_SINGLE_THREADED_RUNTIME builds
+  drop atomics entirely.
+
 
   Object lifecycle state machine:
 
@@ -21,6 +21,7 @@
 #include "swift/Runtime/AccessibleFunction.h"
 #include "swift/Runtime/Concurrent.h"
 #include "swift/Runtime/Metadata.h"
+#include "swift/Threading/Mutex.h"
 #include "Tracing.h"
 
 #include <cstdint>
@@ -89,6 +90,12 @@ struct AccessibleFunctionsState {
   ConcurrentReadableHashMap<AccessibleFunctionCacheEntry> Cache;
   ConcurrentReadableArray<AccessibleFunctionsSection> SectionsToScan;
 
+  /// The number of sections that have already been merged into Cache,
+  /// guarded by IndexLock. Sections registered after an index build are
+  /// merged lazily by the next lookup that misses the cache.
+  size_t IndexedSectionCount = 0;
+  LazyMutex IndexLock;
+
   AccessibleFunctionsState() {
     initializeAccessibleFunctionsLookup();
   }
@@ -140,19 +147,30 @@ static void _dumpAccessibleFunctionRecords() {
   fprintf(stderr, "==== End of Accessible Function Records ====\n");
 }
 
-static const AccessibleFunctionRecord *
-_searchForFunctionRecord(AccessibleFunctionsState &S, llvm::StringRef name) {
-  auto traceState = runtime::trace::accessible_function_scan_begin(name);
-
-  for (const auto &section : S.SectionsToScan.snapshot()) {
+/// Merge every section that hasn't been indexed yet into the cache, so that
+/// lookups are a single hash probe instead of a scan over all records.
+/// Sections are merged in registration order and the first record seen for a
+/// name is kept, matching the order the old linear scan found records in.
+static void _indexAccessibleFunctions(AccessibleFunctionsState &S) {
+  LazyMutex::ScopedLock guard(S.IndexLock);
+
+  auto snapshot = S.SectionsToScan.snapshot();
+  size_t sectionIdx = 0;
+  for (const auto &section : snapshot) {
+    if (sectionIdx++ < S.IndexedSectionCount)
+      continue;
     for (auto &record : section) {
       auto recordName =
           swift::Demangle::makeSymbolicMangledNameStringRef(record.Name.get());
-      if (recordName == name)
-        return traceState.end(&record);
+      S.Cache.getOrInsert(
+          recordName, [&](AccessibleFunctionCacheEntry *entry, bool created) {
+            if (created)
+              ::new (entry) AccessibleFunctionCacheEntry{recordName, &record};
+            return true;
+          });
     }
   }
-  return nullptr;
+  S.IndexedSectionCount = sectionIdx;
 }
 
 SWIFT_RUNTIME_STDLIB_SPI
@@ -169,18 +187,18 @@ swift::runtime::swift_findAccessibleFunction(const char *targetNameStart,
       return E->getRecord();
   }
 
-  // If entry doesn't exist (either record doesn't exist, hasn't been loaded, or
-  // requested yet), let's try to find it and add to the cache.
-
-  auto *record = _searchForFunctionRecord(S, name);
-  if (record) {
-    S.Cache.getOrInsert(
-        name, [&](AccessibleFunctionCacheEntry *entry, bool created) {
-          if (created)
-            ::new (entry) AccessibleFunctionCacheEntry{name, record};
-          return true;
-        });
-  }
+  // If the entry doesn't exist, the record either isn't registered or lives
+  // in a section that hasn't been indexed yet. Merge any unindexed sections
+  // into the cache and probe again; if it's still absent, it doesn't exist in
+  // any currently loaded image.
+  auto traceState = runtime::trace::accessible_function_scan_begin(name);
+  _indexAccessibleFunctions(S);
 
-  return record;
+  {
+    auto snapshot = S.Cache.snapshot();
+    if (auto E = snapshot.find(name))
+      return traceState.end(E->getRecord());
+  }
+  return traceState.end(
+      static_cast<const AccessibleFunctionRecord *>(nullptr));
 }
@@ -49,10 +49,17 @@ struct HashableConformanceEntry {
   /// don't have to deal with cache invalidation.
   const Metadata *baseTypeThatConformsToHashable;
 
+  /// The `Hashable` witness table of the derived type, exactly as returned
+  /// by swift_conformsToProtocolCommon.  Always non-NULL; resolving it once
+  /// per type lets hot boxing paths skip the conformance scan.
+  const WitnessTable *hashableWitnessTable;
+
   HashableConformanceEntry(HashableConformanceKey key,
-                           const Metadata *baseTypeThatConformsToHashable)
+                           const Metadata *baseTypeThatConformsToHashable,
+                           const WitnessTable *hashableWitnessTable)
       : derivedType(key.derivedType),
-        baseTypeThatConformsToHashable(baseTypeThatConformsToHashable) {}
+        baseTypeThatConformsToHashable(baseTypeThatConformsToHashable),
+        hashableWitnessTable(hashableWitnessTable) {}
 
   bool matchesKey(const HashableConformanceKey &key) {
     return derivedType == key.derivedType;
@@ -64,7 +71,8 @@ struct HashableConformanceEntry {
 
   static size_t
   getExtraAllocationSize(HashableConformanceKey key,
-                         const Metadata *baseTypeThatConformsToHashable) {
+                         const Metadata *baseTypeThatConformsToHashable,
+                         const WitnessTable *hashableWitnessTable) {
     return 0;
   }
 
@@ -78,15 +86,25 @@ struct HashableConformanceEntry {
 // protocol conformance cache.
 static ConcurrentReadableHashMap<HashableConformanceEntry> HashableConformances;
 
+namespace {
+/// The cached facts about a type's `Hashable` conformance, returned by
+/// value because cache entries don't outlive their snapshot.
+struct HashableConformanceInfo {
+  const Metadata *baseTypeThatConformsToHashable;
+  const WitnessTable *hashableWitnessTable;
+};
+} // end unnamed namespace
+
 template <bool KnownToConformToHashable>
-SWIFT_ALWAYS_INLINE static const Metadata *
-findHashableBaseTypeImpl(const Metadata *type) {
+SWIFT_ALWAYS_INLINE static HashableConformanceInfo
+lookupHashableConformanceImpl(const Metadata *type) {
   // Check the cache first.
   {
     auto snapshot = HashableConformances.snapshot();
     if (const HashableConformanceEntry *entry =
             snapshot.find(HashableConformanceKey{type})) {
-      return entry->baseTypeThatConformsToHashable;
+      return {entry->baseTypeThatConformsToHashable,
+              entry->hashableWitnessTable};
     }
   }
 
@@ -95,7 +113,7 @@ findHashableBaseTypeImpl(const Metadata *type) {
   if (!KnownToConformToHashable && !witnessTable) {
     // Don't cache the negative response because we don't invalidate
     // this cache when a new conformance is loaded dynamically.
-    return nullptr;
+    return {nullptr, nullptr};
   }
   // By this point, `type` is known to conform to `Hashable`.
 #if SWIFT_STDLIB_USE_RELATIVE_PROTOCOL_WITNESS_TABLES
@@ -111,10 +129,11 @@ findHashableBaseTypeImpl(const Metadata *type) {
   HashableConformances.getOrInsert(key, [&](HashableConformanceEntry *entry,
                                             bool created) {
     if (created)
-      ::new (entry) HashableConformanceEntry(key, baseTypeThatConformsToHashable);
+      ::new (entry) HashableConformanceEntry(key, baseTypeThatConformsToHashable,
+                                             witnessTable);
     return true; // Keep the new entry.
   });
-  return baseTypeThatConformsToHashable;
+  return {baseTypeThatConformsToHashable, witnessTable};
 }
 
 /// Find the base type that introduces the `Hashable` conformance.
@@ -125,7 +144,8 @@ findHashableBaseTypeImpl(const Metadata *type) {
 const Metadata *swift::hashable_support::findHashableBaseTypeOfHashableType(
     const Metadata *type) {
   auto result =
-    findHashableBaseTypeImpl</*KnownToConformToHashable=*/ true>(type);
+    lookupHashableConformanceImpl</*KnownToConformToHashable=*/ true>(type)
+      .baseTypeThatConformsToHashable;
   assert(result && "Known-hashable types should have a `Hashable` conformance.");
   return result;
 }
@@ -134,7 +154,18 @@ const Metadata *swift::hashable_support::findHashableBaseTypeOfHashableType(
 /// If `type` does not conform to `Hashable`, `nullptr` is returned.
 const Metadata *swift::hashable_support::findHashableBaseType(
     const Metadata *type) {
-  return findHashableBaseTypeImpl</*KnownToConformToHashable=*/ false>(type);
+  return lookupHashableConformanceImpl</*KnownToConformToHashable=*/ false>(type)
+      .baseTypeThatConformsToHashable;
+}
+
+/// Find the `Hashable` witness table for the given type, memoized in the
+/// hashable conformance cache.
+/// If `type` does not conform to `Hashable`, `nullptr` is returned.
+const HashableWitnessTable *swift::hashable_support::getHashableConformance(
+    const Metadata *type) {
+  return reinterpret_cast<const HashableWitnessTable *>(
+      lookupHashableConformanceImpl</*KnownToConformToHashable=*/ false>(type)
+          .hashableWitnessTable);
 }
 
 // internal func _makeAnyHashableUsingDefaultRepresentation<H : Hashable>(
@@ -212,6 +212,25 @@ void swift_arrayDestroy(OpaqueValue *begin, size_t count, const Metadata *self)
   if (wtable->isPOD())
     return;
 
+  // Class references use the standard NativeObject (or AnyObject, with ObjC
+  // interop) witnesses; release the elements directly instead of making an
+  // indirect witness call per element. This catches the dominant case of
+  // arrays of class references.
+  if (wtable == &VALUE_WITNESS_SYM(Bo)) {
+    auto **objects = reinterpret_cast<HeapObject **>(begin);
+    for (size_t i = 0; i < count; ++i)
+      swift_release(objects[i]);
+    return;
+  }
+#if SWIFT_OBJC_INTEROP
+  if (wtable == &VALUE_WITNESS_SYM(BO)) {
+    auto **objects = reinterpret_cast<void **>(begin);
+    for (size_t i = 0; i < count; ++i)
+      swift_unknownObjectRelease(objects[i]);
+    return;
+  }
+#endif
+
   auto stride = wtable->getStride();
   if (self->hasLayoutString()) {
       return swift_generic_arrayDestroy(begin, count, stride, self);
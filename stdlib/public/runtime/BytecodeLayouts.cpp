@@ -22,6 +22,8 @@
 #include "WeakReference.h"
 #include "swift/ABI/MetadataValues.h"
 #include "swift/ABI/System.h"
+#include "swift/Basic/Lazy.h"
+#include "swift/Runtime/Concurrent.h"
 #include "swift/Runtime/Error.h"
 #include "swift/Runtime/HeapObject.h"
 #include "llvm/Support/SwapByteOrder.h"
@@ -870,12 +872,183 @@ static void handleRefCountsDestroy(const Metadata *metadata,
   }
 }
 
+namespace {
+
+/// A single decoded step of a destroy plan: the fixed offset of the destroyed
+/// field and the destroyTable entry to invoke on it. For Metatype steps, type
+/// holds the referenced metadata; executing the step points the reader at this
+/// field so metatypeDestroy reads it in place of layout string immediate data.
+struct DestroyPlanStep {
+  uintptr_t addrOffset;
+  RefCountingKind kind;
+  const Metadata *type;
+};
+
+/// Maps a layout string to its decoded destroy plan. A null step array records
+/// that the layout string contains data-dependent operations and has to be
+/// interpreted on every destroy.
+struct DestroyPlanCacheEntry {
+private:
+  const uint8_t *LayoutStr;
+  const DestroyPlanStep *Steps;
+  size_t NumSteps;
+
+public:
+  DestroyPlanCacheEntry(const uint8_t *layoutStr, const DestroyPlanStep *steps,
+                        size_t numSteps)
+      : LayoutStr(layoutStr), Steps(steps), NumSteps(numSteps) {}
+
+  bool matchesKey(const uint8_t *key) const { return LayoutStr == key; }
+
+  friend llvm::hash_code hash_value(const DestroyPlanCacheEntry &entry) {
+    return llvm::hash_value(entry.LayoutStr);
+  }
+
+  template <class... Args>
+  static size_t getExtraAllocationSize(Args &&... ignored) {
+    return 0;
+  }
+
+  const DestroyPlanStep *getSteps() const { return Steps; }
+  size_t getNumSteps() const { return NumSteps; }
+};
+
+} // end anonymous namespace
+
+static Lazy<ConcurrentReadableHashMap<DestroyPlanCacheEntry>> DestroyPlans;
+
+/// Decode \p layoutStr into a flat list of fixed-offset destroy steps.
+///
+/// Returns false if the layout contains operations whose control flow depends
+/// on the destroyed value (enums) or which read immediate data that has to be
+/// resolved per call (resilient references); those layouts cannot be replayed
+/// from a plan.
+static bool decodeDestroyPlan(const uint8_t *layoutStr,
+                              std::vector<DestroyPlanStep> &steps) {
+  LayoutStringReader1 reader{layoutStr + layoutStringHeaderSize};
+  uintptr_t addrOffset = 0;
+  while (true) {
+    auto tag = reader.readBytes<uint64_t>();
+    addrOffset += (tag & ~(0xFFULL << 56));
+    auto kind = (RefCountingKind)(tag >> 56);
+
+    size_t fieldSize;
+    const Metadata *type = nullptr;
+    switch (kind) {
+    case RefCountingKind::End:
+      return true;
+    case RefCountingKind::Error:
+      fieldSize = sizeof(SwiftError *);
+      break;
+    case RefCountingKind::NativeStrong:
+    case RefCountingKind::NativeUnowned:
+    case RefCountingKind::Unknown:
+    case RefCountingKind::Bridge:
+    case RefCountingKind::Block:
+    case RefCountingKind::ObjC:
+      fieldSize = sizeof(void *);
+      break;
+    case RefCountingKind::NativeWeak:
+    case RefCountingKind::UnknownWeak:
+      fieldSize = sizeof(WeakReference);
+      break;
+    case RefCountingKind::UnknownUnowned:
+      fieldSize = sizeof(UnownedReference);
+      break;
+    case RefCountingKind::Metatype:
+      type = reader.readBytes<const Metadata *>();
+      fieldSize = type->vw_size();
+      break;
+    case RefCountingKind::Existential:
+      fieldSize = sizeof(uintptr_t) * NumWords_ValueBuffer;
+      break;
+    default:
+      return false;
+    }
+
+    steps.push_back({addrOffset, kind, type});
+    addrOffset += fieldSize;
+  }
+}
+
+/// Return the destroy plan for \p layoutStr, decoding and caching it on first
+/// use. Returns false if the layout cannot be promoted to a plan.
+///
+/// The returned step array is immortal, like the layout strings keying it.
+static bool getOrBuildDestroyPlan(const uint8_t *layoutStr,
+                                  const DestroyPlanStep *&steps,
+                                  size_t &numSteps) {
+  auto &plans = DestroyPlans.get();
+  {
+    auto snapshot = plans.snapshot();
+    if (auto *entry = snapshot.find(layoutStr)) {
+      steps = entry->getSteps();
+      numSteps = entry->getNumSteps();
+      return steps != nullptr;
+    }
+  }
+
+  std::vector<DestroyPlanStep> decodedSteps;
+  DestroyPlanStep *ownedSteps = nullptr;
+  size_t numDecodedSteps = 0;
+  if (decodeDestroyPlan(layoutStr, decodedSteps)) {
+    numDecodedSteps = decodedSteps.size();
+    auto allocationSize =
+        std::max(numDecodedSteps, size_t(1)) * sizeof(DestroyPlanStep);
+    ownedSteps = (DestroyPlanStep *)malloc(allocationSize);
+    memcpy(ownedSteps, decodedSteps.data(),
+           numDecodedSteps * sizeof(DestroyPlanStep));
+  }
+
+  plans.getOrInsert(layoutStr,
+                    [&](DestroyPlanCacheEntry *entry, bool created) {
+                      if (created) {
+                        ::new (entry) DestroyPlanCacheEntry(
+                            layoutStr, ownedSteps, numDecodedSteps);
+                      } else {
+                        // Another thread won the race to decode this layout;
+                        // keep its plan.
+                        if (ownedSteps)
+                          free(ownedSteps);
+                        ownedSteps =
+                            const_cast<DestroyPlanStep *>(entry->getSteps());
+                        numDecodedSteps = entry->getNumSteps();
+                      }
+                      return true;
+                    });
+
+  steps = ownedSteps;
+  numSteps = numDecodedSteps;
+  return steps != nullptr;
+}
+
+/// Replay a decoded destroy plan on the value at \p addr + \p baseOffset.
+static void executeDestroyPlan(const Metadata *metadata,
+                               const DestroyPlanStep *steps, size_t numSteps,
+                               uint8_t *addr, uintptr_t baseOffset) {
+  for (size_t i = 0; i < numSteps; ++i) {
+    const auto &step = steps[i];
+    uintptr_t addrOffset = baseOffset + step.addrOffset;
+    LayoutStringReader1 reader{reinterpret_cast<const uint8_t *>(&step.type)};
+    destroyTable[static_cast<uint8_t>(step.kind)](metadata, reader, addrOffset,
+                                                  addr);
+  }
+}
+
 extern "C" void
 swift_generic_destroy(swift::OpaqueValue *address, const Metadata *metadata) {
   const uint8_t *layoutStr = metadata->getLayoutString();
+  uint8_t *addr = (uint8_t *)address;
+
+  const DestroyPlanStep *steps;
+  size_t numSteps;
+  if (getOrBuildDestroyPlan(layoutStr, steps, numSteps)) {
+    executeDestroyPlan(metadata, steps, numSteps, addr, 0);
+    return;
+  }
+
   LayoutStringReader1 reader{layoutStr + layoutStringHeaderSize};
   uintptr_t addrOffset = 0;
-  uint8_t *addr = (uint8_t *)address;
 
 #if defined(__APPLE__) && defined(__arm64__)
   handleRefCounts(destroyTable, CONTINUE_NO_COPY, metadata, reader, addrOffset,
@@ -888,6 +1061,15 @@ swift_generic_destroy(swift::OpaqueValue *address, const Metadata *metadata) {
 void swift::swift_generic_arrayDestroy(swift::OpaqueValue *address, size_t count, size_t stride, const Metadata *metadata) {
   const uint8_t *layoutStr = metadata->getLayoutString();
   uint8_t *addr = (uint8_t *)address;
+
+  const DestroyPlanStep *steps;
+  size_t numSteps;
+  if (getOrBuildDestroyPlan(layoutStr, steps, numSteps)) {
+    for (size_t i = 0; i < count; i++)
+      executeDestroyPlan(metadata, steps, numSteps, addr, i * stride);
+    return;
+  }
+
   for (size_t i = 0; i < count; i++) {
     LayoutStringReader1 reader{layoutStr + layoutStringHeaderSize};
     uintptr_t addrOffset = i * stride;
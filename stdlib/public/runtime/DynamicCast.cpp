@@ -17,6 +17,7 @@
 #include "../CompatibilityOverride/CompatibilityOverride.h"
 #include "ErrorObject.h"
 #include "Private.h"
+#include "RuntimeInvocationsTracking.h"
 #include "SwiftHashableSupport.h"
 #include "swift/ABI/MetadataValues.h"
 #include "swift/Basic/Lazy.h"
@@ -467,6 +468,7 @@ tryCastToSwiftClass(
       return DynamicCastResult::Failure;
     }
     if (auto t = swift_dynamicCastClass(srcObject, destClassType)) {
+      SWIFT_RT_TRACK_INVOCATION(nullptr, swift_dynamicCast_classSuccess);
       auto castObject = const_cast<void *>(t);
       *(reinterpret_cast<void **>(destLocation)) = castObject;
       if (takeOnSuccess) {
@@ -831,9 +833,7 @@ tryCastToAnyHashable(
 
   // General case: If it conforms to Hashable, we cast it
   if (hashableConformance == nullptr) {
-    hashableConformance = reinterpret_cast<const HashableWitnessTable *>(
-      swift_conformsToProtocolCommon(srcType, &HashableProtocolDescriptor)
-    );
+    hashableConformance = getHashableConformance(srcType);
   }
   if (hashableConformance) {
     _swift_convertToAnyHashableIndirect(srcValue, destLocation,
@@ -2292,11 +2292,23 @@ tryCast(
       auto srcDynamicType = swift_getObjectType(srcObject);
       if (srcDynamicType != srcType) {
         srcFailureType = srcDynamicType;
-        auto castResult = tryCastToDestType(
-          destLocation, destType, srcValue, srcDynamicType,
-          destFailureType, srcFailureType, takeOnSuccess, mayDeferChecks);
-        if (isSuccess(castResult)) {
-          return castResult;
+        // When the destination is a native class and the source is a class
+        // reference, the attempt above already keyed its superclass walk off
+        // the object's dynamic class (Class and ObjCClassWrapper sources
+        // share that path through tryCastToSwiftClass), so retrying with the
+        // dynamic type repeats the identical walk and cannot change the
+        // verdict. Skip the retry but keep the failure type for diagnostics.
+        bool retryIsRedundant =
+          destKind == MetadataKind::Class
+          && (srcKind == MetadataKind::Class
+              || srcKind == MetadataKind::ObjCClassWrapper);
+        if (!retryIsRedundant) {
+          auto castResult = tryCastToDestType(
+            destLocation, destType, srcValue, srcDynamicType,
+            destFailureType, srcFailureType, takeOnSuccess, mayDeferChecks);
+          if (isSuccess(castResult)) {
+            return castResult;
+          }
         }
       }
     }
@@ -2556,6 +2568,8 @@ swift_dynamicCastImpl(OpaqueValue *destLocation,
                       const Metadata *destType,
                       DynamicCastFlags flags)
 {
+  SWIFT_RT_TRACK_INVOCATION(nullptr, swift_dynamicCast);
+
   // If the compiler has asked for a "take", we can
   // move pointers without ref-counting overhead.
   bool takeOnSuccess = flags & DynamicCastFlags::TakeOnSuccess;
@@ -21,8 +21,11 @@
 
 #if !SWIFT_OBJC_INTEROP
 
+#include <new>
 #include <stdio.h>
 #include "swift/Runtime/Debug.h"
+#include "swift/Runtime/Heap.h"
+#include "swift/Threading/ThreadLocalStorage.h"
 #include "ErrorObject.h"
 #include "Private.h"
 
@@ -45,16 +48,70 @@ _getErrorAllocatedSizeAndAlignmentMask(const Metadata *type) {
   return {size, alignMask};
 }
 
+// A one-slot, per-thread cache of recently destroyed error boxes.
+//
+// Code that uses thrown errors as control flow can allocate and destroy
+// error boxes at very high rates, with every throw/catch cycle paying for a
+// malloc/free pair. Instead of returning a destroyed box of modest size to
+// malloc, park it here and hand it back to the next swift_allocError request
+// with an identical layout. The cache holds raw, type-free storage: the
+// payload has already been destroyed by the time a box is parked, so
+// recycling is sound for any error type without cooperation from the
+// compiler.
+//
+// Boxes with outstanding unowned or weak references cannot be recycled and
+// take the ordinary swift_deallocObject path, as do boxes larger than the
+// cap below. The cache is disabled in runtimes built with the leak checker,
+// freed-object clobbering, or function counters, which all need every box to
+// pass through swift_allocObject/swift_deallocObject.
+#if !defined(SWIFT_RUNTIME_ENABLE_LEAK_CHECKER) &&                             \
+    !defined(SWIFT_RUNTIME_CLOBBER_FREED_OBJECTS) &&                           \
+    !defined(SWIFT_ENABLE_RUNTIME_FUNCTION_COUNTERS) &&                        \
+    defined(SWIFT_THREAD_LOCAL)
+#define SWIFT_HAVE_ERROR_BOX_CACHE 1
+
+/// The largest box the per-thread cache will hold, in bytes.
+static constexpr size_t ErrorBoxCacheMaxSize = 256;
+
+namespace {
+struct ErrorBoxCache {
+  void *box = nullptr;
+  size_t size = 0;
+  size_t alignMask = 0;
+
+  ~ErrorBoxCache() {
+    if (box)
+      swift_slowDealloc(box, size, alignMask);
+  }
+};
+} // end anonymous namespace
+
+static SWIFT_THREAD_LOCAL ErrorBoxCache errorBoxCache;
+#endif
+
 /// Destructor for an Error box.
 static SWIFT_CC(swift) void _destroyErrorObject(SWIFT_CONTEXT HeapObject *obj) {
   auto error = static_cast<SwiftError *>(obj);
-  
+
   // Destroy the value inside.
   auto type = error->type;
   type->vw_destroy(error->getValue());
-  
+
   // Deallocate the buffer.
   auto sizeAndAlign = _getErrorAllocatedSizeAndAlignmentMask(type);
+#if SWIFT_HAVE_ERROR_BOX_CACHE
+  // Park small boxes for reuse instead. A box with outstanding unowned or
+  // weak references still has its header in use and must go through
+  // swift_deallocObject.
+  auto &cache = errorBoxCache;
+  if (!cache.box && sizeAndAlign.first <= ErrorBoxCacheMaxSize &&
+      obj->refCounts.canBeFreedNow()) {
+    cache.box = obj;
+    cache.size = sizeAndAlign.first;
+    cache.alignMask = sizeAndAlign.second;
+    return;
+  }
+#endif
   swift_deallocObject(obj, sizeAndAlign.first, sizeAndAlign.second);
 }
 
@@ -70,10 +127,25 @@ swift::swift_allocError(const swift::Metadata *type,
                         OpaqueValue *initialValue,
                         bool isTake) {
   auto sizeAndAlign = _getErrorAllocatedSizeAndAlignmentMask(type);
-  
-  auto allocated = swift_allocObject(&ErrorMetadata,
-                                     sizeAndAlign.first, sizeAndAlign.second);
-  
+
+  HeapObject *allocated;
+#if SWIFT_HAVE_ERROR_BOX_CACHE
+  auto &cache = errorBoxCache;
+  if (cache.box && cache.size == sizeAndAlign.first &&
+      cache.alignMask == sizeAndAlign.second) {
+    // Reinitialize the header of the recycled box; everything past it is
+    // overwritten below exactly as for a fresh allocation.
+    allocated = new (cache.box) HeapObject(&ErrorMetadata);
+    cache.box = nullptr;
+  } else {
+    allocated = swift_allocObject(&ErrorMetadata, sizeAndAlign.first,
+                                  sizeAndAlign.second);
+  }
+#else
+  allocated = swift_allocObject(&ErrorMetadata,
+                                sizeAndAlign.first, sizeAndAlign.second);
+#endif
+
   auto error = reinterpret_cast<SwiftError*>(allocated);
   
   error->type = type;
@@ -37,8 +37,10 @@ struct SWIFT_LIBRARY_VISIBILITY OpaqueExistentialBoxBase
     auto *vwt = type->getValueWitnesses();
     if (vwt->isValueInline()) {
       // destroy(&valueBuffer)
-      type->vw_destroy(
-          reinterpret_cast<OpaqueValue *>(value->getBuffer(args...)));
+      // Call through the witness table we already loaded for the
+      // isValueInline check rather than reloading it via vw_destroy.
+      vwt->destroy(reinterpret_cast<OpaqueValue *>(value->getBuffer(args...)),
+                   type);
     } else {
       // release(valueBuffer[0])
       swift_release(
@@ -93,7 +95,7 @@ struct SWIFT_LIBRARY_VISIBILITY OpaqueExistentialBoxBase
       auto *srcValue =
           reinterpret_cast<OpaqueValue *>(src->getBuffer(args...));
 
-      type->vw_initializeWithCopy(destValue, srcValue);
+      vwt->initializeWithCopy(destValue, srcValue, type);
     } else {
       // initWithCopy of the reference to the cow box.
       copyReference(dest, src, Dest::Init, Source::Copy, args...);
@@ -129,7 +131,7 @@ struct SWIFT_LIBRARY_VISIBILITY OpaqueExistentialBoxBase
         auto *srcValue =
             reinterpret_cast<OpaqueValue *>(src->getBuffer(args...));
         // assignWithCopy.
-        srcType->vw_assignWithCopy(destValue, srcValue);
+        vwt->assignWithCopy(destValue, srcValue, srcType);
       } else {
         // Outline (boxed value).
         // assignWithCopy.
@@ -149,13 +151,13 @@ struct SWIFT_LIBRARY_VISIBILITY OpaqueExistentialBoxBase
             reinterpret_cast<OpaqueValue *>(src->getBuffer(args...));
 
         // Move dest value aside so we can destroy it later.
-        destType->vw_initializeWithTake(opaqueTmpBuffer, destValue);
+        destVwt->initializeWithTake(opaqueTmpBuffer, destValue, destType);
 
         src->copyTypeInto(dest, args...);
         if (srcVwt->isValueInline()) {
           // Inline src value.
 
-          srcType->vw_initializeWithCopy(destValue, srcValue);
+          srcVwt->initializeWithCopy(destValue, srcValue, srcType);
         } else {
           // Outline src value.
 
@@ -164,7 +166,7 @@ struct SWIFT_LIBRARY_VISIBILITY OpaqueExistentialBoxBase
         }
 
         // Finally, destroy the old dest value.
-        destType->vw_destroy(opaqueTmpBuffer);
+        destVwt->destroy(opaqueTmpBuffer, destType);
       } else {
         // Outline destination value.
 
@@ -180,7 +182,7 @@ struct SWIFT_LIBRARY_VISIBILITY OpaqueExistentialBoxBase
               reinterpret_cast<OpaqueValue *>(dest->getBuffer(args...));
           auto *srcValue =
               reinterpret_cast<OpaqueValue *>(src->getBuffer(args...));
-          srcType->vw_initializeWithCopy(destValue, srcValue);
+          srcVwt->initializeWithCopy(destValue, srcValue, srcType);
         } else {
 
           // initWithCopy of reference to cow box.
@@ -214,7 +216,7 @@ struct SWIFT_LIBRARY_VISIBILITY OpaqueExistentialBoxBase
         auto *srcValue =
             reinterpret_cast<OpaqueValue *>(src->getBuffer(args...));
         // assignWithTake.
-        srcType->vw_assignWithTake(destValue, srcValue);
+        vwt->assignWithTake(destValue, srcValue, srcType);
       } else {
         // Outline (boxed value).
 
@@ -237,13 +239,13 @@ struct SWIFT_LIBRARY_VISIBILITY OpaqueExistentialBoxBase
             reinterpret_cast<OpaqueValue *>(src->getBuffer(args...));
 
         // Move dest value aside.
-        destType->vw_initializeWithTake(opaqueTmpBuffer, destValue);
+        destVwt->initializeWithTake(opaqueTmpBuffer, destValue, destType);
 
         src->copyTypeInto(dest, args...);
         if (srcVwt->isValueInline()) {
           // Inline src value.
 
-          srcType->vw_initializeWithTake(destValue, srcValue);
+          srcVwt->initializeWithTake(destValue, srcValue, srcType);
         } else {
           // Outline src value.
 
@@ -252,7 +254,7 @@ struct SWIFT_LIBRARY_VISIBILITY OpaqueExistentialBoxBase
         }
 
         // Destroy old dest value.
-        destType->vw_destroy(opaqueTmpBuffer);
+        destVwt->destroy(opaqueTmpBuffer, destType);
       } else {
         // Outline destination value.
 
@@ -269,7 +271,7 @@ struct SWIFT_LIBRARY_VISIBILITY OpaqueExistentialBoxBase
           auto *srcValue =
               reinterpret_cast<OpaqueValue *>(src->getBuffer(args...));
           // initWithTake.
-          srcType->vw_initializeWithTake(destValue, srcValue);
+          srcVwt->initializeWithTake(destValue, srcValue, srcType);
         } else {
 
           // initWithTake of reference to cow box.
@@ -18,8 +18,12 @@
 #include "swift/Runtime/Heap.h"
 #include "Private.h"
 #include "swift/Runtime/Debug.h"
+#include "swift/Runtime/EnvironmentVariables.h"
 #include "swift/shims/RuntimeShims.h"
 #include <algorithm>
+#include <atomic>
+#include <inttypes.h>
+#include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
 #if defined(__APPLE__) && SWIFT_STDLIB_HAS_DARWIN_LIBMALLOC
@@ -73,6 +77,46 @@ static size_t computeAlignment(size_t alignMask) {
                                      : alignMask + 1;
 }
 
+namespace {
+
+/// Allocation-size histogram behind SWIFT_DEBUG_HEAP_ALLOCATION_STATS.
+/// Sizes are bucketed at 16-byte granularity up to 1 KiB; larger allocations
+/// share a single overflow bucket.
+constexpr size_t allocationStatsGranularity = 16;
+constexpr size_t allocationStatsMaxTrackedSize = 1024;
+constexpr size_t allocationStatsBucketCount =
+    allocationStatsMaxTrackedSize / allocationStatsGranularity + 1;
+
+std::atomic<uint64_t> allocationStats[allocationStatsBucketCount];
+swift::once_t allocationStatsToken;
+
+void reportAllocationStats() {
+  fprintf(stderr, "swift_slowAlloc allocation counts by size class:\n");
+  for (size_t i = 0; i + 1 < allocationStatsBucketCount; ++i) {
+    uint64_t count = allocationStats[i].load(std::memory_order_relaxed);
+    if (count != 0)
+      fprintf(stderr, "  <= %4zu bytes: %" PRIu64 "\n",
+              (i + 1) * allocationStatsGranularity, count);
+  }
+  uint64_t overflow = allocationStats[allocationStatsBucketCount - 1].load(
+      std::memory_order_relaxed);
+  if (overflow != 0)
+    fprintf(stderr, "   > %4zu bytes: %" PRIu64 "\n",
+            allocationStatsMaxTrackedSize, overflow);
+}
+
+void trackAllocation(size_t size) {
+  swift::once(
+      allocationStatsToken, [](void *) { atexit(reportAllocationStats); },
+      nullptr);
+  size_t bucket = allocationStatsBucketCount - 1;
+  if (size <= allocationStatsMaxTrackedSize)
+    bucket = size == 0 ? 0 : (size - 1) / allocationStatsGranularity;
+  allocationStats[bucket].fetch_add(1, std::memory_order_relaxed);
+}
+
+} // end anonymous namespace
+
 // For alignMask > (_minAllocationAlignment-1)
 // i.e. alignment == 0 || alignment > _minAllocationAlignment:
 //   The runtime must use AlignedAlloc, and the standard library must
@@ -83,6 +127,9 @@ static size_t computeAlignment(size_t alignMask) {
 //   The runtime may use either malloc or AlignedAlloc, and the standard library
 //   must deallocate using an identical alignment.
 void *swift::swift_slowAlloc(size_t size, size_t alignMask) {
+  if (SWIFT_UNLIKELY(
+          runtime::environment::SWIFT_DEBUG_HEAP_ALLOCATION_STATS()))
+    trackAllocation(size);
   void *p;
   // This check also forces "default" alignment to use AlignedAlloc.
   if (alignMask <= MALLOC_ALIGN_MASK) {
@@ -99,6 +146,9 @@ void *swift::swift_slowAllocTyped(size_t size, size_t alignMask,
                                   MallocTypeId typeId) {
 #if SWIFT_STDLIB_HAS_MALLOC_TYPE
   if (__builtin_available(macOS 9998, iOS 9998, tvOS 9998, watchOS 9998, *)) {
+    if (SWIFT_UNLIKELY(
+            runtime::environment::SWIFT_DEBUG_HEAP_ALLOCATION_STATS()))
+      trackAllocation(size);
     void *p;
     // This check also forces "default" alignment to use malloc_memalign().
     if (alignMask <= MALLOC_ALIGN_MASK) {
@@ -41,6 +41,7 @@
 #include "swift/Runtime/Portability.h"
 #include "swift/Strings.h"
 #include "swift/Threading/Mutex.h"
+#include "swift/Threading/ThreadLocalStorage.h"
 #include "llvm/ADT/StringExtras.h"
 #include <algorithm>
 #include <cctype>
@@ -380,6 +381,19 @@ namespace {
       auto metadata =
         pattern->InstantiationFunction(description, arguments, pattern);
 
+      // When requested, log each instantiation so that a prespecializations
+      // library covering the hot instantiations can be built offline. The
+      // instantiation function has already installed the descriptor and the
+      // generic arguments, which is all the mangler reads.
+      if (SWIFT_UNLIKELY(
+              runtime::environment::
+                  SWIFT_DEBUG_LOG_GENERIC_METADATA_INSTANTIATIONS())) {
+        auto name = swift_getMangledTypeName(metadata);
+        if (name.data)
+          swift::warning(0, "Generic metadata instantiation: $s%.*s\n",
+                         (int)name.length, name.data);
+      }
+
       // If there's no completion function, do a quick-and-dirty check to
       // see if all of the type arguments are already complete.  If they
       // are, we can broadcast completion immediately and potentially avoid
@@ -929,6 +943,36 @@ MetadataResponse swift::swift_getCanonicalSpecializedMetadata(
   return result.second;
 }
 
+#ifdef SWIFT_THREAD_LOCAL
+namespace {
+
+/// A tiny per-thread direct-mapped cache in front of the global generic
+/// metadata caches. Generic-heavy code tends to re-request the same handful
+/// of instantiations over and over; a hit here costs a few predictable loads
+/// instead of a hash probe into the concurrent map.
+///
+/// Only complete metadata is stored, and complete metadata is immortal, so a
+/// stale slot is merely wasted space, never a wrong answer. Keys are compared
+/// by raw argument words, which is stricter than MetadataCacheKey equality;
+/// anything that misses here falls through to the global cache.
+struct GenericMetadataPerThreadCache {
+  static constexpr uintptr_t NumEntries = 8;
+  static constexpr size_t MaxArgs = 3;
+
+  struct Entry {
+    const TypeContextDescriptor *Description;
+    const void *Args[MaxArgs];
+    const Metadata *Value;
+  };
+  Entry Entries[NumEntries];
+};
+
+static SWIFT_THREAD_LOCAL GenericMetadataPerThreadCache
+    GenericMetadataThreadCache;
+
+} // end anonymous namespace
+#endif
+
 SWIFT_CC(swift)
 static MetadataResponse
 _swift_getGenericMetadata(MetadataRequest request, const void *const *arguments,
@@ -936,9 +980,41 @@ _swift_getGenericMetadata(MetadataRequest request, const void *const *arguments,
   auto &cache = getCache(*description);
   assert(description->getFullGenericContextHeader().Base.NumKeyArguments ==
          cache.SigLayout.sizeInWords());
+
+#ifdef SWIFT_THREAD_LOCAL
+  // Pack arguments need deep equality, so the per-thread cache only fronts
+  // pack-free signatures with a small number of key arguments.
+  const size_t numWords = cache.SigLayout.sizeInWords();
+  GenericMetadataPerThreadCache::Entry *slot = nullptr;
+  if (cache.SigLayout.NumPacks == 0 &&
+      numWords <= GenericMetadataPerThreadCache::MaxArgs) {
+    uintptr_t hash = reinterpret_cast<uintptr_t>(description) >> 4;
+    for (size_t i = 0; i != numWords; ++i)
+      hash ^= reinterpret_cast<uintptr_t>(arguments[i]) >> 4;
+    slot = &GenericMetadataThreadCache
+                .Entries[hash % GenericMetadataPerThreadCache::NumEntries];
+    if (slot->Description == description) {
+      bool matches = true;
+      for (size_t i = 0; i != numWords; ++i)
+        matches &= (slot->Args[i] == arguments[i]);
+      if (matches)
+        return MetadataResponse{slot->Value, MetadataState::Complete};
+    }
+  }
+#endif
+
   auto key = MetadataCacheKey(cache.SigLayout, arguments);
   auto result = cache.getOrInsert(key, request, description, arguments);
 
+#ifdef SWIFT_THREAD_LOCAL
+  if (slot && result.second.State == MetadataState::Complete) {
+    slot->Description = description;
+    for (size_t i = 0; i != numWords; ++i)
+      slot->Args[i] = arguments[i];
+    slot->Value = result.second.Value;
+  }
+#endif
+
   return result.second;
 }
 
@@ -7596,6 +7672,24 @@ static void checkAllocatorDebugEnvironmentVariables(void *context) {
                      "Warning: SWIFT_DEBUG_ENABLE_METADATA_BACKTRACE_LOGGING "
                      "without SWIFT_DEBUG_ENABLE_METADATA_ALLOCATION_ITERATION "
                      "has no effect.\n");
+
+    // If requested, pre-size the allocation pool with a single mapping so
+    // that metadata-heavy launches don't grow it one page at a time. Pool
+    // memory is never returned wholesale, so abandoning the static initial
+    // pool is harmless. This is skipped under allocation iteration, which
+    // needs its trailer chain rooted in the initial pool.
+    uint32_t initialPages = runtime::environment::
+        SWIFT_METADATA_ALLOCATOR_INITIAL_POOL_PAGES();
+    if (initialPages > 0) {
+      size_t poolSize = size_t(initialPages) * PoolRange::PageSize;
+      auto *pool =
+          reinterpret_cast<char *>(swift_slowAlloc(poolSize, alignof(char) - 1));
+      if (pool) {
+        memsetScribble(pool, poolSize);
+        AllocationPool.store(PoolRange{pool, poolSize},
+                             std::memory_order_relaxed);
+      }
+    }
     return;
   }
 
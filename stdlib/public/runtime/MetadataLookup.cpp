@@ -38,6 +38,7 @@
 #include "llvm/ADT/PointerIntPair.h"
 #include "llvm/ADT/PointerUnion.h"
 #include "llvm/ADT/StringExtras.h"
+#include <atomic>
 #include <cctype>
 #include <cstring>
 #include <functional>
@@ -328,8 +329,14 @@ namespace {
 struct TypeMetadataPrivateState {
   ConcurrentReadableHashMap<NominalTypeDescriptorCacheEntry> NominalCache;
   ConcurrentReadableArray<TypeMetadataSection> SectionsToScan;
-  
-  TypeMetadataPrivateState() {
+
+  /// Incremented whenever sections that name lookup searches are registered.
+  /// Negative cache entries are only inserted if the epoch is unchanged from
+  /// when the failed scan began, so a lookup racing with an image load can't
+  /// cache a failure that the new image would have satisfied.
+  std::atomic<uint32_t> InvalidationEpoch;
+
+  TypeMetadataPrivateState() : InvalidationEpoch(0) {
     initializeTypeMetadataRecordLookup();
   }
 
@@ -337,11 +344,23 @@ struct TypeMetadataPrivateState {
 
 static Lazy<TypeMetadataPrivateState> TypeMetadataRecords;
 
+void swift::_invalidateContextDescriptorCache() {
+  auto &T = TypeMetadataRecords.get();
+  T.InvalidationEpoch.fetch_add(1, std::memory_order_release);
+
+  // Blow away the nominal cache to get rid of any negative entries that may
+  // now be obsolete.
+  T.NominalCache.clear();
+}
+
 static void
 _registerTypeMetadataRecords(TypeMetadataPrivateState &T,
                              const TypeMetadataRecord *begin,
                              const TypeMetadataRecord *end) {
   T.SectionsToScan.push_back(TypeMetadataSection{begin, end});
+
+  T.InvalidationEpoch.fetch_add(1, std::memory_order_release);
+  T.NominalCache.clear();
 }
 
 void swift::addImageTypeMetadataRecordBlockCallbackUnsafe(
@@ -864,7 +883,8 @@ _findContextDescriptor(Demangle::NodePointer node,
   StringRef mangledName = mangling.result();
 
 
-  // Look for an existing entry.
+  // Look for an existing entry. A negative entry records that the name was
+  // already searched for unsuccessfully in every registered section.
   // Find the bucket for the metadata entry.
   {
     auto snapshot = T.NominalCache.snapshot();
@@ -872,23 +892,36 @@ _findContextDescriptor(Demangle::NodePointer node,
       return Value->getDescription();
   }
 
-  // Check type metadata records		   
+  // Remember the epoch before scanning so a failure can be discarded below if
+  // new sections were registered in the meantime.
+  auto scanEpoch = T.InvalidationEpoch.load(std::memory_order_acquire);
+
+  // Check type metadata records
   // Scan any newly loaded images for context descriptors, then try the context
   foundContext = _searchTypeMetadataRecords(T, node);
-  
-  // Check protocol conformances table. Note that this has no support for		
+
+  // Check protocol conformances table. Note that this has no support for
   // resolving generic types yet.
   if (!foundContext)
     foundContext = _searchConformancesByMangledTypeName(node);
-  
-  if (foundContext)
-    T.NominalCache.getOrInsert(mangledName, [&](NominalTypeDescriptorCacheEntry
-                                                    *entry,
-                                                bool created) {
-      if (created)
-        ::new (entry) NominalTypeDescriptorCacheEntry{mangledName, foundContext};
-      return true;
-    });
+
+  T.NominalCache.getOrInsert(mangledName, [&](NominalTypeDescriptorCacheEntry
+                                                  *entry,
+                                              bool created) {
+    if (!created)
+      return false;
+
+    // Only cache a failure if no sections were registered while we scanned.
+    // If one was, the registering thread will clear the cache after we
+    // relinquish the writer lock, so a stale entry slipping in here would
+    // still be removed; checking the epoch just avoids the window entirely.
+    if (!foundContext &&
+        T.InvalidationEpoch.load(std::memory_order_acquire) != scanEpoch)
+      return false;
+
+    ::new (entry) NominalTypeDescriptorCacheEntry{mangledName, foundContext};
+    return true;
+  });
 
   return foundContext;
 }
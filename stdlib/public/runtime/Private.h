@@ -276,6 +276,12 @@ public:
   const ContextDescriptor *
   _searchConformancesByMangledTypeName(Demangle::NodePointer node);
 
+  /// Drop any negative entries from the name-to-context-descriptor cache.
+  /// Must be called whenever sections that _findContextDescriptor searches
+  /// are registered, since a name that failed to resolve before may resolve
+  /// against the new sections.
+  void _invalidateContextDescriptorCache();
+
   SWIFT_RUNTIME_EXPORT
   Demangle::NodePointer _swift_buildDemanglingForMetadata(const Metadata *type,
                                                           Demangle::Demangler &Dem);
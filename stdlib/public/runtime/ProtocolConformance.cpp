@@ -30,6 +30,7 @@
 #include "../CompatibilityOverride/CompatibilityOverride.h"
 #include "ImageInspection.h"
 #include "Private.h"
+#include "RuntimeInvocationsTracking.h"
 #include "Tracing.h"
 
 #include <new>
@@ -549,6 +550,10 @@ static void _registerProtocolConformances(ConformanceState &C,
   // Blow away the conformances cache to get rid of any negative entries that
   // may now be obsolete.
   C.Cache.clear();
+
+  // Mangled-name lookup falls back to searching conformance records, so any
+  // cached name resolution failures may be obsolete as well.
+  _invalidateContextDescriptorCache();
 }
 
 void swift::addImageProtocolConformanceBlockCallbackUnsafe(
@@ -1043,6 +1048,7 @@ swift_conformsToProtocolMaybeInstantiateSuperclasses(
   auto found =
       searchInConformanceCache(type, protocol, instantiateSuperclassMetadata);
   if (found.first) {
+    SWIFT_RT_TRACK_INVOCATION(nullptr, swift_conformsToProtocol_cacheHit);
     // An authoritative negative result can be overridden by a result from dyld.
     if (!found.second) {
       if (dyldCachedWitnessTable)
@@ -1097,6 +1103,7 @@ swift_conformsToProtocolMaybeInstantiateSuperclasses(
     }
   };
 
+  SWIFT_RT_TRACK_INVOCATION(nullptr, swift_conformsToProtocol_sectionScan);
   auto traceState =
       runtime::trace::protocol_conformance_scan_begin(type, protocol);
 
@@ -1157,6 +1164,8 @@ swift_conformsToProtocolMaybeInstantiateSuperclasses(
 static const WitnessTable *
 swift_conformsToProtocolCommonImpl(const Metadata *const type,
                                    const ProtocolDescriptor *protocol) {
+  SWIFT_RT_TRACK_INVOCATION(nullptr, swift_conformsToProtocol);
+
   const WitnessTable *table;
   bool hasUninstantiatedSuperclass;
 
@@ -14,10 +14,20 @@
 
 #include "swift/Runtime/HeapObject.h"
 
+#include "RuntimeInvocationsTracking.h"
+
 namespace swift {
 
 // Return an object's side table, allocating it if necessary.
 // Returns null if the object is deiniting.
+//
+// There is no side table lock. The side table entry's refcounts, like the
+// inline refcounts, are a single atomic word updated with CAS loops, so
+// contention between threads is already scoped to the individual object.
+// The only multi-thread race in this file is two threads allocating a side
+// table for the same object at once; the loser deletes its allocation and
+// adopts the winner's. That event is tracked below so side table contention
+// can be measured with the runtime function counters.
 // SideTableRefCountBits specialization intentionally does not exist.
 template <>
 HeapObjectSideTableEntry* RefCounts<InlineRefCountBits>::allocateSideTable(bool failIfDeiniting)
@@ -39,12 +49,16 @@ HeapObjectSideTableEntry* RefCounts<InlineRefCountBits>::allocateSideTable(bool
   // FIXME: custom side table allocator
   auto side = swift_cxx_newObject<HeapObjectSideTableEntry>(getHeapObject());
 
+  SWIFT_RT_TRACK_INVOCATION(getHeapObject(), swift_sideTableAllocation);
+
   auto newbits = InlineRefCountBits(side);
 
   do {
     if (oldbits.hasSideTable()) {
       // Already have a side table. Return it and delete ours.
       // Read before delete to streamline barriers.
+      SWIFT_RT_TRACK_INVOCATION(getHeapObject(),
+                                swift_sideTableAllocation_raceLost);
       auto result = oldbits.getSideTable();
       swift_cxx_deleteObject(side);
       return result;
@@ -24,6 +24,7 @@
 #include "swift/ABI/MetadataValues.h"
 #include "swift/Runtime/Debug.h"
 #include "llvm/Support/Alignment.h"
+#include <atomic>
 #include <cstddef>
 #include <new>
 
@@ -93,6 +94,43 @@ private:
   static constexpr uintptr_t magicUninitialized =   (uintptr_t)0xcdcdcdcdcdcdcdcdull;
   static constexpr uintptr_t magicEndOfAllocation = (uintptr_t)0xdeadbeafdeadbeafull;
 
+  /// Process-wide slab telemetry, shared by all allocators of this
+  /// instantiation.
+  ///
+  /// The counters are only touched when a slab is malloc'd or freed, which is
+  /// rare compared to alloc()/dealloc(), so relaxed atomics are cheap enough
+  /// to keep unconditionally enabled.
+  struct Statistics {
+    /// Total number of slabs malloc'd over the lifetime of the process.
+    std::atomic<size_t> numSlabAllocations{0};
+    /// Current sum of malloc'd slab capacities, in bytes. Does not include
+    /// slab headers or pre-allocated first slabs.
+    std::atomic<size_t> slabBytes{0};
+    /// High-water mark of slabBytes.
+    std::atomic<size_t> slabBytesHighWaterMark{0};
+  };
+
+  static inline Statistics stats;
+
+  /// Record that a slab of \p capacity bytes was malloc'd.
+  static void noteSlabAllocated(size_t capacity) {
+    stats.numSlabAllocations.fetch_add(1, std::memory_order_relaxed);
+    size_t total =
+        stats.slabBytes.fetch_add(capacity, std::memory_order_relaxed) +
+        capacity;
+    size_t highWater =
+        stats.slabBytesHighWaterMark.load(std::memory_order_relaxed);
+    while (total > highWater &&
+           !stats.slabBytesHighWaterMark.compare_exchange_weak(
+               highWater, total, std::memory_order_relaxed)) {
+    }
+  }
+
+  /// Record that slabs totalling \p capacity bytes were freed.
+  static void noteSlabsFreed(size_t capacity) {
+    stats.slabBytes.fetch_sub(capacity, std::memory_order_relaxed);
+  }
+
   /// A memory slab holding multiple allocations.
   ///
   /// This struct is actually just the slab header. The slab buffer is tail
@@ -258,6 +296,7 @@ private:
     else
       firstSlab = newSlab;
     numAllocatedSlabs++;
+    noteSlabAllocated(capacity);
     return newSlab;
   }
 
@@ -274,6 +313,7 @@ private:
       numAllocatedSlabs--;
       slab = next;
     }
+    noteSlabsFreed(freedCapacity);
     return freedCapacity;
   }
 
@@ -336,6 +376,11 @@ public:
 
   /// For unit testing.
   int getNumAllocatedSlabs() { return numAllocatedSlabs; }
+
+  /// Return the process-wide slab statistics of this instantiation.
+  ///
+  /// For performance investigations and unit testing.
+  static const Statistics &getStatistics() { return stats; }
 };
 
 } // namespace swift
@@ -57,6 +57,14 @@ const Metadata *findHashableBaseTypeOfHashableType(
 /// If `type` does not conform to `Hashable`, `nullptr` is returned.
 const Metadata *findHashableBaseType(const Metadata *type);
 
+/// Find the `Hashable` witness table for the given type, resolving it at
+/// most once per type: the result is stored alongside the cached hashable
+/// base type, so repeated queries (e.g. boxing every key of an
+/// `[AnyHashable: Any]` payload) skip the conformance scan entirely.
+/// If `type` does not conform to `Hashable`, `nullptr` is returned and
+/// nothing is cached.
+const HashableWitnessTable *getHashableConformance(const Metadata *type);
+
 } // namespace hashable_support
 } // namespace swift
 
@@ -31,6 +31,7 @@
 #include "swift/Runtime/ObjCBridge.h"
 #include "swift/Runtime/Debug.h"
 #include "swift/Threading/Mutex.h"
+#include "swift/Threading/ThreadLocalStorage.h"
 #include "Private.h"
 #include "SwiftEquatableSupport.h"
 #include "SwiftHashableSupport.h"
@@ -129,10 +130,9 @@ SwiftValueHeader::cacheHashableEquatableConformance() const {
     uintptr_t conformance;
     uintptr_t baseType;
 
-    // First, see if it's Hashable
-    const HashableWitnessTable *hashable =
-      reinterpret_cast<const HashableWitnessTable *>(
-	swift_conformsToProtocolCommon(type, &HashableProtocolDescriptor));
+    // First, see if it's Hashable. This shares one cache entry with the
+    // base-type lookup below.
+    const HashableWitnessTable *hashable = getHashableConformance(type);
     if (hashable != nullptr) {
       conformance = reinterpret_cast<uintptr_t>(hashable);
       baseType = reinterpret_cast<uintptr_t>(findHashableBaseType(type));
@@ -288,9 +288,51 @@ swift::getValueFromSwiftValue(__SwiftValue *v) {
   return {instanceType, getSwiftValuePayload(v, alignMask)};
 }
 
+#ifdef SWIFT_THREAD_LOCAL
+#define SWIFT_HAVE_RECENT_SWIFT_VALUE_CACHE 1
+
+namespace {
+/// A one-slot, per-thread cache of the most recently created box for a small
+/// trivial payload. Bridging tends to box the same few payloads over and over
+/// (small integers and enum discriminators flowing into collections); boxes
+/// are immutable, and byte-identical trivial payloads are indistinguishable
+/// once boxed, so the previous box can be handed out again at +1 instead of
+/// allocating a fresh one.
+struct RecentSwiftValueCache {
+  static constexpr size_t MaxPayloadSize = 16;
+
+  __SwiftValue *box = nil;
+  const Metadata *type = nullptr;
+  size_t size = 0;
+  char bytes[MaxPayloadSize];
+
+  ~RecentSwiftValueCache() {
+    if (box)
+      objc_release(box);
+  }
+};
+} // end anonymous namespace
+
+static SWIFT_THREAD_LOCAL RecentSwiftValueCache recentSwiftValueCache;
+#endif
+
 __SwiftValue *swift::bridgeAnythingToSwiftValueObject(OpaqueValue *src,
                                                     const Metadata *srcType,
                                                     bool consume) {
+#ifdef SWIFT_HAVE_RECENT_SWIFT_VALUE_CACHE
+  auto *srcVWT = srcType->getValueWitnesses();
+  bool cacheable =
+      srcVWT->isPOD() && srcVWT->size <= RecentSwiftValueCache::MaxPayloadSize;
+  auto &cache = recentSwiftValueCache;
+  if (cacheable && cache.box && cache.type == srcType &&
+      cache.size == srcVWT->size &&
+      memcmp(cache.bytes, src, srcVWT->size) == 0) {
+    // Consuming a trivial source is a no-op, so the source needs no cleanup
+    // on this path.
+    return objc_retain(cache.box);
+  }
+#endif
+
   size_t alignMask = getSwiftValuePayloadAlignMask(srcType);
 
   size_t totalSize =
@@ -315,6 +357,17 @@ __SwiftValue *swift::bridgeAnythingToSwiftValueObject(OpaqueValue *src,
   else
     srcType->vw_initializeWithCopy(payload, src);
 
+#ifdef SWIFT_HAVE_RECENT_SWIFT_VALUE_CACHE
+  if (cacheable) {
+    if (cache.box)
+      objc_release(cache.box);
+    cache.box = objc_retain(instance);
+    cache.type = srcType;
+    cache.size = srcVWT->size;
+    memcpy(cache.bytes, payload, srcVWT->size);
+  }
+#endif
+
   return instance;
 }
 
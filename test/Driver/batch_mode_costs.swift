@@ -0,0 +1,20 @@
+// RUN: %empty-directory(%t)
+// RUN: %{python} -c 'print("//" * 50000)' > %t/file-01.swift
+// RUN: touch %t/file-02.swift %t/file-03.swift %t/file-04.swift %t/file-05.swift %t/file-06.swift
+//
+// RUN: %swiftc_driver -enable-batch-mode -driver-show-job-lifecycle -driver-skip-execution -j 2 %t/file-01.swift %t/file-02.swift %t/file-03.swift %t/file-04.swift %t/file-05.swift %t/file-06.swift | %FileCheck %s
+//
+// Batches are balanced by estimated cost (primary-input size), not by file
+// count: the one large file should get a batch to itself rather than dragging
+// half of the remaining files along with it.
+//
+// CHECK: Found 6 batchable jobs
+// CHECK: Forming into 2 batches
+// CHECK: Adding {compile: {{file-01-.*}} <= file-01.swift} to batch 0
+// CHECK: Adding {compile: {{file-02-.*}} <= file-02.swift} to batch 1
+// CHECK: Adding {compile: {{file-03-.*}} <= file-03.swift} to batch 1
+// CHECK: Adding {compile: {{file-04-.*}} <= file-04.swift} to batch 1
+// CHECK: Adding {compile: {{file-05-.*}} <= file-05.swift} to batch 1
+// CHECK: Adding {compile: {{file-06-.*}} <= file-06.swift} to batch 1
+// CHECK: Forming batch job from 1 constituents
+// CHECK: Forming batch job from 5 constituents
@@ -0,0 +1,3 @@
+func secondCaller() -> Int {
+    return /*test:call*/aFunc()
+}
@@ -0,0 +1,12 @@
+func /*test:def*/aFunc() -> Int {
+    return 1
+}
+
+func caller() -> Int {
+    return /*test:call*/aFunc()
+}
+
+// REQUIRES: swift_swift_parser
+// RUN: %empty-directory(%t.ranges)
+// RUN: %refactor -find-rename-ranges -source-filename %s %S/Inputs/batch-multiple-files-second.swift -pos="test" -is-function-like -old-name "aFunc()" >> %t.ranges/batch-multiple-files.swift
+// RUN: diff -u %S/Outputs/batch-multiple-files.swift.expected %t.ranges/batch-multiple-files.swift
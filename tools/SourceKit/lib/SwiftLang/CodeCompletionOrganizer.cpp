@@ -75,13 +75,22 @@ std::vector<Completion *> SourceKit::CodeCompletion::extendCompletions(
     SwiftCompletionInfo &info, const NameToPopularityMap *nameToPopularity,
     const Options &options, Completion *prefix, bool clearFlair) {
 
-  ImportDepth depth;
-  if (info.compilerInstance) {
-    // Build import depth map.
-    depth = ImportDepth(
-        info.compilerInstance->getASTContext(),
-        info.compilerInstance->getInvocation().getFrontendOptions());
-  }
+  // The import-graph BFS behind ImportDepth is only needed to rank results
+  // from other modules; build it on the first such result so that requests
+  // without any (e.g. most member completions) skip it entirely.
+  std::optional<ImportDepth> depth;
+  auto getDepth = [&]() -> ImportDepth & {
+    if (!depth) {
+      if (info.compilerInstance) {
+        depth.emplace(
+            info.compilerInstance->getASTContext(),
+            info.compilerInstance->getInvocation().getFrontendOptions());
+      } else {
+        depth.emplace();
+      }
+    }
+    return *depth;
+  };
 
   if (info.completionContext)
     sink.adoptSwiftSink(info.completionContext->getResultSink());
@@ -90,7 +99,7 @@ std::vector<Completion *> SourceKit::CodeCompletion::extendCompletions(
   for (auto *result : swiftResults) {
     CompletionBuilder builder(sink, *result);
     if (result->getSemanticContext() == SemanticContextKind::OtherModule) {
-      builder.setModuleImportDepth(depth.lookup(result->getModuleName()));
+      builder.setModuleImportDepth(getDepth().lookup(result->getModuleName()));
 
       if (info.completionContext->typeContextKind ==
               TypeContextKind::Required &&
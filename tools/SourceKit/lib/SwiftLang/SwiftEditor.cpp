@@ -1170,6 +1170,15 @@ struct SwiftEditorDocument::Implementation {
 
   std::shared_ptr<SwiftDocumentSyntaxInfo> SyntaxInfo;
 
+  /// The compiler invocation and arguments used to build \c SyntaxInfo,
+  /// together with the semantic invocation they were derived from. Deriving
+  /// the invocation involves re-parsing compiler arguments, so it is only
+  /// redone when the semantic invocation changes rather than on every edit.
+  bool HasSyntaxInfoInvocation = false;
+  SwiftInvocationRef SyntaxInfoInvok;
+  CompilerInvocation SyntaxInfoCompInv;
+  std::vector<std::string> SyntaxInfoArgs;
+
   std::shared_ptr<SwiftDocumentSyntaxInfo> getSyntaxInfo() {
     llvm::sys::ScopedLock L(AccessMtx);
     SyntaxInfo->parseIfNeeded();
@@ -2096,30 +2105,38 @@ void SwiftEditorDocument::resetSyntaxInfo(ImmutableTextSnapshotRef Snapshot,
 
   assert(Impl.SemanticInfo && "Impl.SemanticInfo must be set");
 
-  std::vector<std::string> Args;
-  std::string PrimaryFile; // Ignored, Impl.FilePath will be used
+  auto SemaInvok = Impl.SemanticInfo->getInvocation();
+  if (!Impl.HasSyntaxInfoInvocation ||
+      Impl.SyntaxInfoInvok.get() != SemaInvok.get()) {
+    std::string PrimaryFile; // Ignored, Impl.FilePath will be used
 
-  CompilerInvocation CompInv;
-  if (Impl.SemanticInfo->getInvocation()) {
-    Impl.SemanticInfo->getInvocation()->applyTo(CompInv);
-    Impl.SemanticInfo->getInvocation()->raw(Args, PrimaryFile);
-  } else {
-    // Use stdin as a .swift input to satisfy the driver. Note that we don't
-    // use Impl.FilePath here because it may be invalid filename for driver
-    // like "" or "-foobar".
-    SmallVector<const char *, 1> Args;
-    Args.push_back("-");
-    std::string Error;
-    // Ignore possible error(s)
-    Lang.getASTManager()->initCompilerInvocation(
-        CompInv, Args, FrontendOptions::ActionType::Parse, StringRef(), Error);
-  }
-  // When reuse parts of the syntax tree from a SyntaxParsingCache, not
-  // all tokens are visited and thus token collection is invalid
-  CompInv.getLangOptions().CollectParsedToken = true;
+    Impl.SyntaxInfoCompInv = CompilerInvocation();
+    Impl.SyntaxInfoArgs.clear();
+    if (SemaInvok) {
+      SemaInvok->applyTo(Impl.SyntaxInfoCompInv);
+      SemaInvok->raw(Impl.SyntaxInfoArgs, PrimaryFile);
+    } else {
+      // Use stdin as a .swift input to satisfy the driver. Note that we don't
+      // use Impl.FilePath here because it may be invalid filename for driver
+      // like "" or "-foobar".
+      SmallVector<const char *, 1> Args;
+      Args.push_back("-");
+      std::string Error;
+      // Ignore possible error(s)
+      Lang.getASTManager()->initCompilerInvocation(
+          Impl.SyntaxInfoCompInv, Args, FrontendOptions::ActionType::Parse,
+          StringRef(), Error);
+    }
+    // When reuse parts of the syntax tree from a SyntaxParsingCache, not
+    // all tokens are visited and thus token collection is invalid
+    Impl.SyntaxInfoCompInv.getLangOptions().CollectParsedToken = true;
+
+    Impl.SyntaxInfoInvok = SemaInvok;
+    Impl.HasSyntaxInfoInvocation = true;
+  }
   // Access to Impl.SyntaxInfo is guarded by Impl.AccessMtx
-  Impl.SyntaxInfo.reset(
-    new SwiftDocumentSyntaxInfo(CompInv, Snapshot, Args, Impl.FilePath));
+  Impl.SyntaxInfo.reset(new SwiftDocumentSyntaxInfo(
+      Impl.SyntaxInfoCompInv, Snapshot, Impl.SyntaxInfoArgs, Impl.FilePath));
 }
 
 static UIdent SemaDiagStage("source.diagnostic.stage.swift.sema");
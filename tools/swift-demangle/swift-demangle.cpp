@@ -21,6 +21,7 @@
 #include "llvm/Support/MemoryBuffer.h"
 #include "llvm/Support/PrettyStackTrace.h"
 #include "llvm/Support/Signals.h"
+#include "llvm/Support/ThreadPool.h"
 #include "llvm/Support/raw_ostream.h"
 
 // For std::rand, to work around a bug if main()'s first function call passes
@@ -29,7 +30,9 @@
 #include <cstdlib>
 #endif
 
+#include <algorithm>
 #include <iostream>
+#include <vector>
 
 using namespace swift::Demangle;
 
@@ -73,6 +76,12 @@ static llvm::cl::opt<bool>
 Classify("classify",
            llvm::cl::desc("Display symbol classification characters"));
 
+static llvm::cl::opt<unsigned>
+NumThreads("j",
+           llvm::cl::desc("Demangle standard input on this many threads "
+                          "(0 means one per hardware core)"),
+           llvm::cl::init(1));
+
 /// Options that are primarily used for testing.
 /// \{
 static llvm::cl::opt<bool> DisplayLocalNameContexts(
@@ -361,24 +370,79 @@ static bool findMaybeMangled(llvm::StringRef input, llvm::StringRef &match) {
   return false;
 }
 
-static int demangleSTDIN(const swift::Demangle::DemangleOptions &options) {
-  swift::Demangle::Context DCtx;
-  for (std::string mangled; std::getline(std::cin, mangled);) {
-    llvm::StringRef inputContents(mangled);
-    llvm::StringRef match;
-
-    while (findMaybeMangled(inputContents, match)) {
-      llvm::outs() << substrBefore(inputContents, match);
-      demangle(llvm::outs(), match, DCtx, options);
-      inputContents = substrAfter(inputContents, match);
+static void demangleLine(llvm::raw_ostream &os, llvm::StringRef line,
+                         swift::Demangle::Context &DCtx,
+                         const swift::Demangle::DemangleOptions &options) {
+  llvm::StringRef match;
+
+  while (findMaybeMangled(line, match)) {
+    os << substrBefore(line, match);
+    demangle(os, match, DCtx, options);
+    line = substrAfter(line, match);
+  }
+
+  os << line << '\n';
+}
+
+/// Demangle standard input by distributing batches of lines across a thread
+/// pool, each worker using its own demangler context, and emitting each
+/// batch's output in input order.
+static int demangleSTDINParallel(
+    const swift::Demangle::DemangleOptions &options, unsigned threadCount) {
+  llvm::ThreadPool pool(llvm::hardware_concurrency(threadCount));
+
+  // Keep shards small enough that batches stream promptly, but large enough
+  // that per-task overhead is noise next to the demangling itself.
+  const size_t linesPerShard = 1024;
+  std::vector<std::string> lines;
+  bool reachedEOF = false;
+
+  while (!reachedEOF) {
+    // Read one batch, one shard of lines per worker.
+    lines.clear();
+    for (std::string mangled; lines.size() < linesPerShard * threadCount;) {
+      if (!std::getline(std::cin, mangled)) {
+        reachedEOF = true;
+        break;
+      }
+      lines.push_back(std::move(mangled));
     }
 
-    llvm::outs() << inputContents << '\n';
+    size_t numShards = (lines.size() + linesPerShard - 1) / linesPerShard;
+    std::vector<std::string> shardOutput(numShards);
+    for (size_t shard = 0; shard < numShards; ++shard) {
+      pool.async([&, shard] {
+        swift::Demangle::Context DCtx;
+        llvm::raw_string_ostream os(shardOutput[shard]);
+        size_t begin = shard * linesPerShard;
+        size_t end = std::min(begin + linesPerShard, lines.size());
+        for (size_t i = begin; i != end; ++i)
+          demangleLine(os, lines[i], DCtx, options);
+      });
+    }
+    pool.wait();
+
+    for (const std::string &output : shardOutput)
+      llvm::outs() << output;
   }
 
   return EXIT_SUCCESS;
 }
 
+static int demangleSTDIN(const swift::Demangle::DemangleOptions &options) {
+  unsigned threadCount = NumThreads != 0
+      ? NumThreads.getValue()
+      : llvm::hardware_concurrency().compute_thread_count();
+  if (threadCount > 1)
+    return demangleSTDINParallel(options, threadCount);
+
+  swift::Demangle::Context DCtx;
+  for (std::string mangled; std::getline(std::cin, mangled);)
+    demangleLine(llvm::outs(), mangled, DCtx, options);
+
+  return EXIT_SUCCESS;
+}
+
 int main(int argc, char **argv) {
 #if defined(__CYGWIN__)
   // Cygwin clang 3.5.2 with '-O3' generates CRASHING BINARY,
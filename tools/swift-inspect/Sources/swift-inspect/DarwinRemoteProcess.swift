@@ -71,7 +71,33 @@ internal final class DarwinRemoteProcess: RemoteProcess {
     }
   }
 
+  // The reflection context drives ReadBytes with a stream of small reads
+  // (individual metadata words and descriptor fields), each of which would
+  // otherwise round-trip through task_peek. Batch them up: peek whole pages
+  // and serve sub-reads out of a local cache. Pointers returned by task_peek
+  // stay valid until task_stop_peeking in deinit, so cached pages can be
+  // handed out directly.
+  private static let peekPageSize: swift_addr_t = 0x4000
+  private var peekPages: [swift_addr_t: UnsafeRawPointer] = [:]
+
   func read(address: swift_addr_t, size: Int) -> UnsafeRawPointer? {
+    let page = address & ~(Self.peekPageSize - 1)
+
+    // Pass reads that straddle a page boundary through directly.
+    guard address + swift_addr_t(size) <= page + Self.peekPageSize else {
+      return task_peek(task, address, mach_vm_size_t(size))
+    }
+
+    if let contents = peekPages[page] {
+      return contents + Int(address - page)
+    }
+    if let contents = task_peek(task, page, mach_vm_size_t(Self.peekPageSize)) {
+      peekPages[page] = contents
+      return contents + Int(address - page)
+    }
+
+    // The surrounding page may not be entirely mapped; retry just the
+    // requested range.
     return task_peek(task, address, mach_vm_size_t(size))
   }
 
@@ -61,7 +61,7 @@ private struct ProcessMetadata: Encodable {
   var metadata: [Metadata]
 }
 
-private struct MetadataSummary: Encodable {
+private struct MetadataSummary: Codable {
   var totalSize: Int
   var processes: Set<String>
 }
@@ -156,7 +156,9 @@ internal struct DumpGenericMetadata: ParsableCommand {
         }
     } // inspect
 
-    if genericMetadataOptions.json {
+    if let snapshotPath = genericMetadataOptions.diff {
+      try dumpDiff(of: metadataSummary, against: snapshotPath)
+    } else if genericMetadataOptions.json {
       if genericMetadataOptions.summary {
         try dumpJson(of: metadataSummary)
       } else {
@@ -210,6 +212,36 @@ internal struct DumpGenericMetadata: ParsableCommand {
     }
   }
 
+  private func dumpDiff(of current: [String: MetadataSummary],
+                        against snapshotPath: String) throws {
+    let data = try Data(contentsOf: URL(fileURLWithPath: snapshotPath))
+    let baseline = try JSONDecoder().decode([String: MetadataSummary].self,
+                                            from: data)
+
+    var rows: [(name: String, sizeChange: Int, size: Int)] = []
+    for (name, summary) in current {
+      rows.append((name, summary.totalSize - (baseline[name]?.totalSize ?? 0),
+                   summary.totalSize))
+    }
+    // Types whose metadata was present in the snapshot but is gone now.
+    for (name, summary) in baseline where current[name] == nil {
+      rows.append((name, -summary.totalSize, 0))
+    }
+
+    var output = try Output(genericMetadataOptions.outputFile)
+    print("Size Change", "Size", "Name", separator: "\t", to: &output)
+    var totalChange = 0
+    rows.sorted { first, second in
+      first.sizeChange > second.sizeChange
+    }
+    .forEach { row in
+      guard row.sizeChange != 0 else { return }
+      totalChange += row.sizeChange
+      print(row.sizeChange, row.size, row.name, separator: "\t", to: &output)
+    }
+    print("\nTotal size change:\t\(totalChange) bytes", to: &output)
+  }
+
   private func dumpTextSummary(of: [String: MetadataSummary]) throws {
     var output = try Output(genericMetadataOptions.outputFile)
     print("Size", "Owners", "Name", separator: "\t", to: &output)
@@ -74,6 +74,14 @@ internal struct GenericMetadataOptions: ParsableArguments {
   #endif
   var summary: Bool = false
 
+  @Option(help: ArgumentHelp(
+      "Print the per-type size change relative to an earlier snapshot",
+      discussion: "The snapshot is a file produced by a previous run with " +
+                  "--json --summary --output-file. Comparing two snapshots " +
+                  "of a long-running process pinpoints runaway generic " +
+                  "metadata instantiation."))
+  var diff: String? = nil
+
   @Option(help: "Output to a file")
   var outputFile: String? = nil
 }
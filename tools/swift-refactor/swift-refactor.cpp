@@ -448,16 +448,42 @@ int main(int argc, char *argv[]) {
       NewName = "";
     }
 
-    std::vector<RenameLoc> RenameLocs =
-        getRenameLocs(BufferID, SM, Start, options::OldName, NewName);
-
     if (options::Action != RefactoringKind::FindGlobalRenameRanges) {
       llvm_unreachable("unexpected refactoring kind");
     }
-    auto SyntacticRenameRanges =
-        findSyntacticRenameRanges(SF, RenameLocs, NewName);
-    return printSyntacticRenameRanges(SyntacticRenameRanges, SM, BufferID,
-                                      llvm::outs());
+
+    // Process the primary file and then any other source file of the module
+    // containing the labeled positions, so a cross-file rename is resolved as
+    // one batch in a single warmed compiler instance rather than one process
+    // per file.
+    int ExitCode = 1;
+    for (auto Unit : CI.getMainModule()->getFiles()) {
+      auto *File = dyn_cast<SourceFile>(Unit);
+      if (!File)
+        continue;
+
+      unsigned FileBufferID = File->getBufferID().value();
+      std::vector<RefactorLoc> FileLocs;
+      if (File == SF) {
+        FileLocs = Start;
+      } else {
+        std::string FileBuffer =
+            SM.getRangeForBuffer(FileBufferID).str().str();
+        FileLocs =
+            getLocsByLabelOrPosition(options::LineColumnPair, FileBuffer);
+        if (FileLocs.empty())
+          continue;
+      }
+
+      std::vector<RenameLoc> RenameLocs =
+          getRenameLocs(FileBufferID, SM, FileLocs, options::OldName, NewName);
+      auto SyntacticRenameRanges =
+          findSyntacticRenameRanges(File, RenameLocs, NewName);
+      if (printSyntacticRenameRanges(SyntacticRenameRanges, SM, FileBufferID,
+                                     llvm::outs()) == 0)
+        ExitCode = 0;
+    }
+    return ExitCode;
   }
 
   RangeConfig Range = getRange(BufferID, SM, StartLoc, EndLoc);
@@ -190,6 +190,9 @@ static int doDumpReflectionSections(ArrayRef<std::string> BinaryFilenames,
 int main(int argc, char *argv[]) {
   PROGRAM_START(argc, argv);
   llvm::cl::ParseCommandLineOptions(argc, argv, "Swift Reflection Dump\n");
+  // The dump is emitted via many small stream writes; don't pay for
+  // synchronization with C stdio on every one of them.
+  std::ios_base::sync_with_stdio(false);
   return doDumpReflectionSections(options::BinaryFilename,
                                   options::Architecture, options::Action,
                                   std::cout);
@@ -330,3 +330,42 @@ TEST(StableHasher, Vectors) {
     in.push_back(i);
   }
 }
+
+TEST(StableHasher, BulkVectors) {
+  uint8_t k[16];
+  for (unsigned i = 0; i < 16; ++i) {
+    k[i] = i;
+  }
+  uint64_t one = 0;
+  memcpy(&one, k, sizeof(uint64_t));
+  uint64_t two = 0;
+  memcpy(&two, k + 8, sizeof(uint64_t));
+
+  // Bulk-combining a buffer must yield the same digest as combining it
+  // byte by byte.
+  std::vector<uint8_t> in;
+  for (unsigned i = 0; i < 64; ++i) {
+    auto hasher = StableHasher{one, two};
+    hasher.combine_bytes(in.data(), in.size());
+
+    auto hasherData = std::move(hasher).finalize();
+    EXPECT_EQ(hasherData.first, U8TO64_LE(vectors_sip128[i]));
+    EXPECT_EQ(hasherData.second, U8TO64_LE(vectors_sip128[i] + 8));
+
+    in.push_back(i);
+  }
+
+  // Splitting the input at every offset exercises topping off a
+  // partially-filled inline buffer. vectors_sip128[63] covers the first 63
+  // bytes, so drop the last one pushed above.
+  in.pop_back();
+  for (unsigned split = 0; split <= in.size(); ++split) {
+    auto hasher = StableHasher{one, two};
+    hasher.combine_bytes(in.data(), split);
+    hasher.combine_bytes(in.data() + split, in.size() - split);
+
+    auto hasherData = std::move(hasher).finalize();
+    EXPECT_EQ(hasherData.first, U8TO64_LE(vectors_sip128[63]));
+    EXPECT_EQ(hasherData.second, U8TO64_LE(vectors_sip128[63] + 8));
+  }
+}
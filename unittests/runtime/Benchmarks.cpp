@@ -0,0 +1,169 @@
+//===--- Benchmarks.cpp - Runtime entry point microbenchmarks -------------===//
+//
+// This source file is part of the Swift.org open source project
+//
+// Copyright (c) 2014 - 2026 Apple Inc. and the Swift project authors
+// Licensed under Apache License v2.0 with Runtime Library Exception
+//
+// See https://swift.org/LICENSE.txt for license information
+// See https://swift.org/CONTRIBUTORS.txt for the list of Swift project authors
+//
+//===----------------------------------------------------------------------===//
+//
+// Microbenchmarks for hot runtime entry points. These run as ordinary gtest
+// cases so they stay compiled and exercised by every test run, but with a
+// deliberately small default iteration count so correctness CI stays fast.
+// For real measurement, scale the loop up with
+//
+//   SWIFT_RUNTIME_BENCH_ITERATIONS=10000000 SwiftRuntimeTests \
+//     --gtest_filter='RuntimeBench.*'
+//
+// Each benchmark prints one machine-readable line of the form
+//
+//   SwiftRuntimeBench: <name> <iterations> iters <ns/op> ns/op
+//
+// so a CI job can grep the output and diff the numbers between commits.
+//
+//===----------------------------------------------------------------------===//
+
+#include "swift/Runtime/Casting.h"
+#include "swift/Runtime/HeapObject.h"
+#include "swift/Runtime/Metadata.h"
+#include "gtest/gtest.h"
+#include <chrono>
+#include <cinttypes>
+#include <cstdio>
+#include <cstdlib>
+
+using namespace swift;
+
+namespace {
+
+struct TestObject : HeapObject {
+  constexpr TestObject(HeapMetadata const *newMetadata)
+    : HeapObject(newMetadata, InlineRefCounts::Immortal) {}
+};
+
+SWIFT_CC(swift) void destroyTestObject(SWIFT_CONTEXT HeapObject *object) {
+  swift_deallocObject(object, sizeof(TestObject), alignof(TestObject) - 1);
+}
+
+const FullMetadata<ClassMetadata> TestClassObjectMetadata = {
+  { { nullptr }, { &destroyTestObject }, { &VALUE_WITNESS_SYM(Bo) } },
+  { { nullptr }, ClassFlags::UsesSwiftRefcounting, 0, 0, 0, 0, 0, 0 }
+};
+
+TestObject *allocTestObject() {
+  return static_cast<TestObject *>(
+      swift_allocObject(&TestClassObjectMetadata, sizeof(TestObject),
+                        alignof(TestObject) - 1));
+}
+
+/// Keep \p value alive and visible to the optimizer so benchmark bodies
+/// aren't folded away.
+template <class T>
+void doNotOptimize(T const &value) {
+#if defined(__GNUC__) || defined(__clang__)
+  asm volatile("" : : "r,m"(value) : "memory");
+#else
+  volatile const T *sink = &value;
+  (void)sink;
+#endif
+}
+
+uint64_t benchmarkIterations() {
+  if (const char *str = getenv("SWIFT_RUNTIME_BENCH_ITERATIONS")) {
+    uint64_t value = strtoull(str, nullptr, 10);
+    if (value > 0)
+      return value;
+  }
+  // Cheap enough to run unconditionally as part of the test suite.
+  return 10 * 1000;
+}
+
+template <class Body>
+void runBenchmark(const char *name, Body &&body) {
+  uint64_t iterations = benchmarkIterations();
+  // Warm up once so lazily-initialized runtime state (metadata caches,
+  // side table allocations) isn't charged to the first timed iteration.
+  body();
+  auto start = std::chrono::steady_clock::now();
+  for (uint64_t i = 0; i < iterations; ++i)
+    body();
+  auto elapsed = std::chrono::steady_clock::now() - start;
+  auto ns =
+      std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count();
+  printf("SwiftRuntimeBench: %s %" PRIu64 " iters %.2f ns/op\n", name,
+         iterations, double(ns) / double(iterations));
+}
+
+} // end anonymous namespace
+
+TEST(RuntimeBench, retainRelease) {
+  auto object = allocTestObject();
+  runBenchmark("retainRelease", [&] {
+    swift_retain(object);
+    swift_release(object);
+  });
+  EXPECT_EQ(1u, swift_retainCount(object));
+  swift_release(object);
+}
+
+TEST(RuntimeBench, nonatomicRetainRelease) {
+  auto object = allocTestObject();
+  runBenchmark("nonatomicRetainRelease", [&] {
+    swift_nonatomic_retain(object);
+    swift_nonatomic_release(object);
+  });
+  EXPECT_EQ(1u, swift_retainCount(object));
+  swift_release(object);
+}
+
+TEST(RuntimeBench, allocDealloc) {
+  runBenchmark("allocDealloc", [] {
+    auto object = allocTestObject();
+    doNotOptimize(object);
+    swift_release(object);
+  });
+}
+
+TEST(RuntimeBench, unownedRetainRelease) {
+  auto object = allocTestObject();
+  runBenchmark("unownedRetainRelease", [&] {
+    swift_unownedRetain(object);
+    swift_unownedRelease(object);
+  });
+  EXPECT_EQ(1u, swift_unownedRetainCount(object));
+  swift_release(object);
+}
+
+TEST(RuntimeBench, weakInitLoadDestroy) {
+  auto object = allocTestObject();
+  runBenchmark("weakInitLoadDestroy", [&] {
+    WeakReference ref;
+    swift_weakInit(&ref, object);
+    auto strong = swift_weakLoadStrong(&ref);
+    doNotOptimize(strong);
+    swift_release(strong);
+    swift_weakDestroy(&ref);
+  });
+  EXPECT_EQ(1u, swift_retainCount(object));
+  swift_release(object);
+}
+
+TEST(RuntimeBench, getMetatypeMetadataCacheHit) {
+  runBenchmark("getMetatypeMetadataCacheHit", [] {
+    auto metatype = swift_getMetatypeMetadata(&TestClassObjectMetadata);
+    doNotOptimize(metatype);
+  });
+}
+
+TEST(RuntimeBench, dynamicCastClassSuccess) {
+  auto object = allocTestObject();
+  runBenchmark("dynamicCastClassSuccess", [&] {
+    auto result = swift_dynamicCastClass(object, &TestClassObjectMetadata);
+    doNotOptimize(result);
+  });
+  EXPECT_EQ(object, swift_dynamicCastClass(object, &TestClassObjectMetadata));
+  swift_release(object);
+}
@@ -0,0 +1,49 @@
+// Expression-heavy stress source for compiler-bench.
+//
+// Long operator chains and mixed-literal arithmetic exercise the constraint
+// solver's handling of overloaded operators and literal protocols. Keep every
+// expression cheap enough to stay well below the solver's expression-too-
+// complex limits: the point is to measure steady-state solving throughput,
+// not to time out.
+
+func mixedArithmetic(_ x: Int, _ y: Double) -> Double {
+  let a = Double(x) + y * 2.0 - 1.5 + Double(x * 3) / 4.0
+  let b = a * a + 2.0 * a + 1.0 - y / 3.0 + Double(x % 7)
+  let c = (a + b) * (a - b) + (a * b) / (1.0 + a * a)
+  let d = c + a * 0.25 + b * 0.5 + 0.125 + Double(x) * 0.0625
+  return a + b + c + d
+}
+
+func comparisonChains(_ n: Int) -> Bool {
+  let a = n > 0 && n < 100 || n == -1 || n == -2 && n != -3
+  let b = n + 1 > n - 1 && n * 2 < n * 3 || n / 2 == n / 2
+  let c = (n & 1) == 0 || (n | 2) > 1 && (n ^ 3) != 0
+  return a && b || c && a || b && c
+}
+
+func stringConcat(_ s: String, _ n: Int) -> String {
+  let t = s + "-" + String(n) + ":" + s + "/" + String(n * 2)
+  let u = t + t + "." + s + String(n + 1) + String(n + 2)
+  return u + "|" + t + "|" + s
+}
+
+func closureChains(_ xs: [Int]) -> Int {
+  let a = xs.map { $0 + 1 }.filter { $0 % 2 == 0 }.reduce(0, +)
+  let b = xs.map { $0 * $0 }.filter { $0 > 10 }.reduce(1, *)
+  let c = xs.filter { $0 != 0 }.map { 100 / $0 }.reduce(0, -)
+  return a + b + c
+}
+
+func ternaryTowers(_ n: Int) -> Int {
+  let a = n > 0 ? (n > 10 ? n * 2 : n * 3) : (n < -10 ? -n : 0)
+  let b = a % 2 == 0 ? a / 2 : a * 3 + 1
+  let c = b > a ? b - a : a - b
+  return a + b + c
+}
+
+func nestedCalls(_ x: Int, _ y: Double) -> Double {
+  return mixedArithmetic(ternaryTowers(x),
+                         mixedArithmetic(x, y) + Double(closureChains([x])))
+    + (comparisonChains(x) ? 1.0 : 0.0)
+    + Double(stringConcat("s", x).count)
+}
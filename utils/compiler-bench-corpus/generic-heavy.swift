@@ -0,0 +1,62 @@
+// Generic-heavy stress source for compiler-bench.
+//
+// Deeply nested generic types and layered generic functions exercise generic
+// signature construction, substitution, and type lowering. (A macro-heavy
+// source would be the fourth natural member of this corpus, but macro
+// expansion requires an external plugin binary, which an in-tree hermetic
+// corpus cannot depend on.)
+
+struct Pair<A, B> {
+  var first: A
+  var second: B
+}
+
+struct Wrap<T> {
+  var value: T
+}
+
+enum Either<L, R> {
+  case left(L)
+  case right(R)
+}
+
+func swap2<A, B>(_ p: Pair<A, B>) -> Pair<B, A> {
+  return Pair(first: p.second, second: p.first)
+}
+
+func rewrap<T>(_ w: Wrap<Wrap<T>>) -> Wrap<T> {
+  return w.value
+}
+
+func pick<L, R>(_ e: Either<L, R>, _ l: L, _ r: R) -> Pair<L, R> {
+  switch e {
+  case .left:
+    return Pair(first: l, second: r)
+  case .right:
+    return Pair(first: l, second: r)
+  }
+}
+
+func deepen<T>(_ value: T) -> Wrap<Wrap<Wrap<T>>> {
+  return Wrap(value: Wrap(value: Wrap(value: value)))
+}
+
+func zip3<A, B, C>(_ a: A, _ b: B, _ c: C) -> Pair<A, Pair<B, C>> {
+  return Pair(first: a, second: Pair(first: b, second: c))
+}
+
+func shuffle<A, B, C>(_ p: Pair<A, Pair<B, C>>) -> Pair<Pair<A, B>, C> {
+  return Pair(first: Pair(first: p.first, second: p.second.first),
+              second: p.second.second)
+}
+
+func tower() -> Int {
+  let nested = deepen(Pair(first: 1, second: "one"))
+  let unwrapped = rewrap(rewrap(Wrap(value: nested)).value).value
+  let swapped = swap2(unwrapped)
+  let either: Either<Int, String> = .left(2)
+  let picked = pick(either, swapped.second.count, swapped.first)
+  let zipped = zip3(picked, deepen(3.0), swap2(picked))
+  let shuffled = shuffle(zipped)
+  return shuffled.first.first.first + shuffled.first.first.second.count
+}
@@ -0,0 +1,49 @@
+// Large-literal stress source for compiler-bench.
+//
+// Big homogeneous and nested collection literals exercise literal protocol
+// conformance lookup and the solver's handling of wide literal expressions.
+
+let wideInts: [Int] = [
+  0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15,
+  16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31,
+  32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47,
+  48, 49, 50, 51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63,
+  64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79,
+  80, 81, 82, 83, 84, 85, 86, 87, 88, 89, 90, 91, 92, 93, 94, 95,
+  96, 97, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111,
+  112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 123, 124, 125, 126, 127,
+]
+
+let wideDoubles: [Double] = [
+  0.0, 0.5, 1.0, 1.5, 2.0, 2.5, 3.0, 3.5, 4.0, 4.5, 5.0, 5.5,
+  6.0, 6.5, 7.0, 7.5, 8.0, 8.5, 9.0, 9.5, 10.0, 10.5, 11.0, 11.5,
+  12.0, 12.5, 13.0, 13.5, 14.0, 14.5, 15.0, 15.5, 16.0, 16.5, 17.0, 17.5,
+  18.0, 18.5, 19.0, 19.5, 20.0, 20.5, 21.0, 21.5, 22.0, 22.5, 23.0, 23.5,
+]
+
+let wideStrings: [String] = [
+  "alpha", "bravo", "charlie", "delta", "echo", "foxtrot", "golf", "hotel",
+  "india", "juliett", "kilo", "lima", "mike", "november", "oscar", "papa",
+  "quebec", "romeo", "sierra", "tango", "uniform", "victor", "whiskey",
+  "xray", "yankee", "zulu",
+]
+
+let keyed: [String: [Int]] = [
+  "evens": [0, 2, 4, 6, 8, 10, 12, 14, 16, 18, 20, 22, 24, 26, 28, 30],
+  "odds": [1, 3, 5, 7, 9, 11, 13, 15, 17, 19, 21, 23, 25, 27, 29, 31],
+  "squares": [0, 1, 4, 9, 16, 25, 36, 49, 64, 81, 100, 121, 144, 169],
+  "cubes": [0, 1, 8, 27, 64, 125, 216, 343, 512, 729, 1000, 1331],
+  "fibs": [0, 1, 1, 2, 3, 5, 8, 13, 21, 34, 55, 89, 144, 233, 377],
+]
+
+let nested: [[(Int, String)]] = [
+  [(0, "zero"), (1, "one"), (2, "two"), (3, "three")],
+  [(4, "four"), (5, "five"), (6, "six"), (7, "seven")],
+  [(8, "eight"), (9, "nine"), (10, "ten"), (11, "eleven")],
+  [(12, "twelve"), (13, "thirteen"), (14, "fourteen"), (15, "fifteen")],
+]
+
+func literalSummary() -> Int {
+  return wideInts.count + wideDoubles.count + wideStrings.count
+    + keyed.count + nested.count
+}
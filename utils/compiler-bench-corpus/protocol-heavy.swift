@@ -0,0 +1,70 @@
+// Protocol-heavy stress source for compiler-bench.
+//
+// Layered protocols with associated types, conditional conformances, and
+// constrained extensions exercise requirement resolution, conformance
+// checking, and associated-type inference.
+
+protocol Corpus {
+  associatedtype Element
+  func sample() -> Element
+}
+
+protocol MutableCorpus: Corpus {
+  mutating func absorb(_ element: Element)
+}
+
+protocol CountedCorpus: Corpus {
+  var count: Int { get }
+}
+
+protocol CombiningCorpus: MutableCorpus, CountedCorpus
+    where Element: Equatable {
+  func contains(_ element: Element) -> Bool
+}
+
+struct Box<T>: Corpus {
+  var value: T
+  func sample() -> T { return value }
+}
+
+struct Bag<T: Equatable>: CombiningCorpus {
+  var storage: [T] = []
+  var count: Int { return storage.count }
+  func sample() -> T { return storage[0] }
+  mutating func absorb(_ element: T) { storage.append(element) }
+  func contains(_ element: T) -> Bool { return storage.contains(element) }
+}
+
+extension Box: Equatable where T: Equatable {}
+extension Box: Hashable where T: Hashable {}
+
+extension Corpus where Element: Comparable {
+  func isAbove(_ bound: Element) -> Bool { return sample() > bound }
+}
+
+extension CountedCorpus where Element: Numeric {
+  func weighted() -> Element { return sample() * sample() }
+}
+
+func merge<A: CombiningCorpus, B: CombiningCorpus>(
+  _ a: A, _ b: B
+) -> [A.Element] where A.Element == B.Element {
+  var result: [A.Element] = []
+  if a.count > 0 { result.append(a.sample()) }
+  if b.count > 0 && !a.contains(b.sample()) { result.append(b.sample()) }
+  return result
+}
+
+func probe() -> Int {
+  var ints = Bag<Int>()
+  ints.absorb(1)
+  ints.absorb(2)
+  var more = Bag<Int>()
+  more.absorb(3)
+  let boxes = Box(value: Box(value: 4))
+  return merge(ints, more).count
+    + (ints.isAbove(0) ? 1 : 0)
+    + ints.weighted()
+    + boxes.sample().sample()
+    + (Box(value: 5) == Box(value: 5) ? 1 : 0)
+}